@@ -1116,6 +1116,24 @@
 //#define MULTIPLE_PROBING 2
 //#define EXTRA_PROBING    1
 
+/**
+ * Adaptive Multiple Probing
+ *
+ * An alternative to MULTIPLE_PROBING. Take slow probes until the accepted
+ * readings agree within PROBE_SAMPLE_TOLERANCE, then return their average.
+ * Readings far from the median (in Median Absolute Deviations) are rejected.
+ * A short retract between samples saves time on each extra probe.
+ * Use 'G29 V3' to report the number of samples and time for each point.
+ */
+//#define PROBE_ADAPTIVE_SAMPLING
+#if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+  #define PROBE_SAMPLES_MIN        2     // Minimum number of slow probes per point
+  #define PROBE_SAMPLES_MAX        5     // Maximum number of slow probes per point
+  #define PROBE_SAMPLE_TOLERANCE   0.005 // (mm) Stop when the accepted readings are this close
+  #define PROBE_SAMPLE_MAD_LIMIT   3.0   // Reject readings more than this many MADs from the median
+  #define PROBE_SAMPLE_CLEARANCE   1.0   // (mm) Raise between samples. Must release the probe trigger.
+#endif
+
 /**
  * Z probes require clearance when deploying, stowing, and moving between
  * probe points to avoid hitting the bed and other hardware.
@@ -1498,6 +1516,22 @@
 
   //#define UBL_HILBERT_CURVE       // Use Hilbert distribution for less travel when probing multiple points
 
+  /**
+   * Fly-by scanning with G29 P1 O. Sweep each mesh row at a fixed height while
+   * the endstop ISR latches the XY position of probe edges. Passes step down
+   * by PROBE_SCAN_Z_STEP, lifting over points already found, and heights are
+   * interpolated between the edges of successive passes.
+   * For non-contact (inductive or capacitive) fixed-mount probes only. Points
+   * above the scan range or missed by the scan are probed normally.
+   */
+  //#define PROBE_FLYBY_SCAN
+  #if ENABLED(PROBE_FLYBY_SCAN)
+    #define PROBE_SCAN_FEEDRATE (40*60) // (mm/min) XY feedrate while scanning
+    #define PROBE_SCAN_RANGE      0.5   // (mm) Scan above and below the center point
+    #define PROBE_SCAN_Z_STEP     0.05  // (mm) Z step between passes
+    #define PROBE_SCAN_EVENTS     16    // Probe edges buffered per row
+  #endif
+
   #define UBL_MESH_EDIT_MOVES_Z     // Sophisticated users prefer no movement of nozzle
   #define UBL_SAVE_ACTIVE_ON_M500   // Save the currently active mesh in the current slot on M500
 
@@ -1520,6 +1554,19 @@
 
 #endif // BED_LEVELING
 
+#if ANY(AUTO_BED_LEVELING_LINEAR, AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL, MESH_BED_LEVELING)
+  /**
+   * Plan the G29 probing order to minimize travel time between points.
+   * Hilbert and nearest-neighbor orders are refined with 2-opt passes.
+   * Enable DEBUG_LEVELING_FEATURE and M111 S32 to report the estimated
+   * travel time of each strategy.
+   */
+  //#define PROBE_PATH_OPTIMIZER
+  #if ENABLED(PROBE_PATH_OPTIMIZER)
+    #define PROBE_PATH_2OPT_PASSES 4  // Each pass costs O(n^2) for n grid points
+  #endif
+#endif
+
 /**
  * Add a bed leveling sub-menu for ABL or MBL.
  * Include a guided procedure if manual probing is enabled.
@@ -1289,6 +1289,35 @@
 
   #define SD_PROCEDURE_DEPTH 1              // Increase if you need more nested M32 calls
 
+  // Keep this many 512-byte blocks of the printed file buffered ahead, read
+  // during idle time so the main loop doesn't wait on the card mid-print.
+  // Stalls that still hit the card are reported when the print finishes.
+  //#define SD_READ_AHEAD 4
+
+  // Look up file clusters in a separate 512-byte FAT cache so that reading a
+  // fragmented file doesn't push its data out of the block cache.
+  //#define SD_FAT_CACHE
+
+  // Index this many items of the current folder when it's first listed, so the
+  // media menu can read any item without scanning the ones before it.
+  // Costs 2 bytes per item, plus 5 bytes with SDCARD_SORT_ALPHA for faster sorting.
+  //#define SD_DIR_INDEX 256
+
+  // Keep a layer index (JOB.IDX) beside each print file, built in idle time when
+  // the file is first opened. Progress then follows the filament used, M27 reports
+  // the layer, and 'M26 L<layer>' restarts a print from any layer.
+  //#define SD_PRINT_INDEX
+
+  // Collect lines written by M928 logging and M28 uploads in RAM and write them to
+  // the card in whole blocks. Space for a log is reserved when it's opened, and the
+  // directory entry is only updated on flush, so after a power loss the log is
+  // complete up to the last flush.
+  //#define SD_LOG_BUFFER
+  #if ENABLED(SD_LOG_BUFFER)
+    #define SD_LOG_FLUSH_INTERVAL  5  // (s) Time from the first buffered line to the flush
+    #define SD_LOG_PREALLOCATE    64  // (KB) Space reserved for a new log
+  #endif
+
   #define SD_FINISHED_STEPPERRELEASE true   // Disable steppers when SD Print is finished
   #define SD_FINISHED_RELEASECOMMAND "M84"  // Use "M84XYE" to keep Z enabled so your bed stays in place
 
@@ -1333,6 +1362,11 @@
     // especially with "vase mode" printing. Set too high and vases cannot be continued.
     #define POWER_LOSS_MIN_Z_CHANGE 0.05 // (mm) Minimum Z change before saving power-loss data
 
+    // Keep a ring of records in the recovery file instead of rewriting it on every save.
+    // Each record is written from idle() with a single block write. On resume the record
+    // with the highest sequence number and a good CRC is used, so a torn write is harmless.
+    //#define POWER_LOSS_RECOVERY_SLOTS 4 // (2..16) Number of 512-byte records in the ring
+
     // Enable if Z homing is needed for proper recovery. 99.9% of the time this should be disabled!
     //#define POWER_LOSS_RECOVER_ZHOME
     #if ENABLED(POWER_LOSS_RECOVER_ZHOME)
@@ -1385,6 +1419,10 @@
   // This allows hosts to request long names for files and folders with M33
   //#define LONG_FILENAME_HOST_SUPPORT
 
+  // Let hosts list files in pages with 'M20 S<start> C<count>', adding
+  // modified times with 'T' and long names with 'L' (with the option above)
+  //#define M20_PAGED_LISTING
+
   // Enable this option to scroll long filenames in the SD card menu
   //#define SCROLL_LONG_FILENAMES
 
@@ -1469,6 +1507,10 @@
   // Add an optimized binary file transfer mode, initiated with 'M28 B1'
   //#define BINARY_FILE_TRANSFER
 
+  // Buffer this many blocks of a binary upload and write them to the card in
+  // one multi-block sequence. Uses 512 bytes of RAM per block. (2, 4, 8, 16)
+  //#define BINARY_FILE_TRANSFER_BLOCKS 8
+
   /**
    * Set this option to one of the following (or the board's defaults apply):
    *
@@ -1905,6 +1947,19 @@
 
 #if BOTH(AUTO_BED_LEVELING_UBL, EEPROM_SETTINGS)
   //#define OPTIMIZED_MESH_STORAGE  // Store mesh with less precision to save EEPROM space
+  #if ENABLED(OPTIMIZED_MESH_STORAGE)
+    /**
+     * Compress stored meshes so EEPROM holds many more of them,
+     * e.g., one for each build plate and bed temperature.
+     * The first mesh saved is kept in a hidden slot as the reference. Slots
+     * store their difference from it, packed with variable bit width and
+     * checked with a CRC. This uses one slot's worth of EEPROM.
+     */
+    //#define MESH_BANK
+    #if ENABLED(MESH_BANK)
+      #define MESH_BANK_SLOT_SIZE 128     // (bytes) Meshes that don't compress to this size can't be saved
+    #endif
+  #endif
 #endif
 
 /**
@@ -2032,6 +2087,17 @@
 // Moves (or segments) with fewer steps than this will be joined with the next move
 #define MIN_STEPS_PER_SEGMENT 6
 
+/**
+ * SCARA / TPARA trig tables
+ * Use interpolated lookup tables for the sin, cos, atan2, and acos terms of the arm
+ * kinematics instead of the math library, and skip forward kinematics when the arm
+ * angles haven't changed. With 256 entries the error is about 1 µm on a 200mm arm.
+ */
+//#define SCARA_TRIG_TABLE
+#if ENABLED(SCARA_TRIG_TABLE)
+  #define SCARA_TRIG_TABLE_SIZE 256     // Entries per 90°, a power of 2. Costs 8 bytes of SRAM each.
+#endif
+
 /**
  * Minimum delay before and after setting the stepper DIR (in ns)
  *     0 : No delay (Expect at least 10µS since one Stepper ISR must transpire)
@@ -2102,6 +2168,27 @@
 #define MAX_CMD_SIZE 96
 #define BUFSIZE 4
 
+/**
+ * Pre-parsed Command Queue
+ *
+ * Parse commands as they're added to the queue and store them in a compact
+ * form (letter, code, parameter bits, values). Each entry takes about a third
+ * of a MAX_CMD_SIZE line, so BUFSIZE can be raised 3-4x in the same SRAM, and
+ * commands don't have to be parsed again when they run.
+ *
+ * Commands with a string argument, a sub-code, too many parameters, or a
+ * non-numeric value are kept as text in a small pool of MAX_CMD_SIZE lines.
+ * Commands aren't pre-parsed while writing to SD (M28) or with M111 S1 echo.
+ * With ADVANCED_OK the "ok" for a pre-parsed command has no N<line> number.
+ *
+ * Requires FASTER_GCODE_PARSER.
+ */
+//#define PREPARSED_GCODE_QUEUE
+#if ENABLED(PREPARSED_GCODE_QUEUE)
+  #define PREPARSED_TEXT_BUFSIZE  2   // Lines of text for commands that can't be pre-parsed
+  #define PREPARSED_GCODE_PARAMS  5   // Most parameters in a pre-parsed command (BINARY_GCODE needs 9)
+#endif
+
 // Transmission to Host Buffer Size
 // To save 386 bytes of PROGMEM (and TX_BUFFER_SIZE+3 bytes of RAM) set to 0.
 // To buffer a simple "ok" you need 4 bytes.
@@ -2142,6 +2229,11 @@
 // Not supported on all platforms.
 //#define RX_BUFFER_MONITOR
 
+// Read serial input in place from the RX buffer, freeing up to this many bytes
+// at a time, instead of a character at a time. Used where the serial driver
+// allows it (AVR, LINUX). Other ports read a character at a time.
+//#define SERIAL_READ_CHUNK 32
+
 /**
  * Emergency Command Parser
  *
@@ -2181,6 +2273,37 @@
 // Some clients will have this feature soon. This could make the NO_TIMEOUTS unnecessary.
 //#define ADVANCED_OK
 
+/**
+ * Resend Window
+ * Hosts that send several lines ahead (e.g., with ADVANCED_OK) may send lines
+ * again after an error, or keep sending before they see "Resend:". Skip these
+ * without an error. Lines already accepted get "ok". Lines past the expected
+ * one get another "Resend:" without clearing the RX buffer.
+ * Lines are recognized this many lines back and ahead.
+ */
+//#define SERIAL_RESEND_WINDOW 8
+
+/**
+ * Serial Flow Credits
+ * Let the host stream commands without waiting for each "ok". After M577 S1
+ * each "ok" includes C<count>, the bytes read from the port so far (modulo
+ * 65536), and the free command queue slots. The host may send while
+ * (bytes sent - C) is less than the window given by M577, which is the size
+ * of the RX buffer on a hardware serial port. Commands stay in the RX buffer
+ * while the command queue is full, so the window also covers it.
+ * Not compatible with MEATPACK. See gcode/host/M577.cpp for details.
+ */
+//#define SERIAL_FLOW_CREDITS
+
+/**
+ * Serial Output Buffer
+ * Collect the output for each serial port and pass it on a line at a time
+ * instead of a byte at a time. With SERIAL_FLOW_CREDITS, output to a host
+ * streaming with M577 S1 is held and sent every few ms, so "ok" replies and
+ * auto-reports are combined into fewer packets.
+ */
+//#define SERIAL_OUTPUT_BUFFER 64 // (bytes) per serial port
+
 // Printrun may have trouble receiving long strings all at once.
 // This option inserts short delays between lines of serial output.
 #define SERIAL_OVERRUN_PROTECTION
@@ -3504,6 +3627,19 @@
 // Support for MeatPack G-code compression (https://github.com/scottmudge/OctoPrint-MeatPack)
 //#define MEATPACK_ON_SERIAL_PORT_1
 //#define MEATPACK_ON_SERIAL_PORT_2
+#if EITHER(MEATPACK_ON_SERIAL_PORT_1, MEATPACK_ON_SERIAL_PORT_2)
+  // Add a mode for heatshrink (LZSS) compressed streams, about twice as dense as packing alone.
+  // Needs a host that supports it. Uses about 300 bytes of SRAM per MeatPack port.
+  //#define MEATPACK_HEATSHRINK
+#endif
+
+/**
+ * Binary G-code
+ * Accept G0-G3, M104, and M106 as binary frames that go into the command queue
+ * already parsed. Hosts enable it per port with 0xFF 0xFF 0xF5, as with MeatPack,
+ * and can still send text commands between frames. See feature/binary_gcode.h.
+ */
+//#define BINARY_GCODE
 
 //#define GCODE_CASE_INSENSITIVE  // Accept G-code sent to the firmware in lowercase
 
@@ -4001,6 +4137,9 @@
 
 // Enable Marlin dev mode which adds some special commands
 //#define MARLIN_DEV_MODE
+#if ENABLED(MARLIN_DEV_MODE)
+  //#define GCODE_DISPATCH_STATS  // D8: Report the count and handler time of each command. D8 R to reset.
+#endif
 
 /**
  * Postmortem Debugging captures misbehavior and outputs the CPU status and backtrace to serial.
@@ -376,24 +376,10 @@ int MarlinSerial<Cfg>::peek() {
   return h == t ? -1 : rx_buffer.buffer[t];
 }
 
+// Send XON once the RX buffer has drained enough
+//    -Called after advancing the tail, with 'h' and 't' the head and new tail -
 template<typename Cfg>
-int MarlinSerial<Cfg>::read() {
-  const ring_buffer_pos_t h = atomic_read_rx_head();
-
-  // Read the tail. Main thread owns it, so it is safe to directly read it
-  ring_buffer_pos_t t = rx_buffer.tail;
-
-  // If nothing to read, return now
-  if (h == t) return -1;
-
-  // Get the next char
-  const int v = rx_buffer.buffer[t];
-  t = (ring_buffer_pos_t)(t + 1) & (Cfg::RX_SIZE - 1);
-
-  // Advance tail - Making sure the RX ISR will always get an stable value, even
-  // if it interrupts the writing of the value of that variable in the middle.
-  atomic_set_rx_tail(t);
-
+FORCE_INLINE void MarlinSerial<Cfg>::rx_check_xon(const ring_buffer_pos_t h, const ring_buffer_pos_t t) {
   if (Cfg::XONOFF) {
     // If the XOFF char was sent, or about to be sent...
     if ((xon_xoff_state & XON_XOFF_CHAR_MASK) == XOFF_CHAR) {
@@ -415,10 +401,53 @@ int MarlinSerial<Cfg>::read() {
       }
     }
   }
+}
+
+template<typename Cfg>
+int MarlinSerial<Cfg>::read() {
+  const ring_buffer_pos_t h = atomic_read_rx_head();
+
+  // Read the tail. Main thread owns it, so it is safe to directly read it
+  ring_buffer_pos_t t = rx_buffer.tail;
+
+  // If nothing to read, return now
+  if (h == t) return -1;
+
+  // Get the next char
+  const int v = rx_buffer.buffer[t];
+  t = (ring_buffer_pos_t)(t + 1) & (Cfg::RX_SIZE - 1);
+
+  // Advance tail - Making sure the RX ISR will always get an stable value, even
+  // if it interrupts the writing of the value of that variable in the middle.
+  atomic_set_rx_tail(t);
+
+  rx_check_xon(h, t);
 
   return v;
 }
 
+// Point to the chars from the tail up to the head, or to the end of the buffer if it wraps
+template<typename Cfg>
+int MarlinSerial<Cfg>::rxSpan(const uint8_t **data, const int size) {
+  const ring_buffer_pos_t h = atomic_read_rx_head();
+
+  // Read the tail. Main thread owns it, so it is safe to directly read it
+  const ring_buffer_pos_t t = rx_buffer.tail;
+
+  const int n = (h >= t ? h : Cfg::RX_SIZE) - t;
+  *data = &rx_buffer.buffer[t];
+  return n < size ? n : size;
+}
+
+// Advance the tail once for all the chars taken with rxSpan
+template<typename Cfg>
+void MarlinSerial<Cfg>::rxRelease(const int count) {
+  const ring_buffer_pos_t h = atomic_read_rx_head(),
+                          t = (ring_buffer_pos_t)(rx_buffer.tail + count) & (Cfg::RX_SIZE - 1);
+  atomic_set_rx_tail(t);
+  rx_check_xon(h, t);
+}
+
 template<typename Cfg>
 typename MarlinSerial<Cfg>::ring_buffer_pos_t MarlinSerial<Cfg>::available() {
   const ring_buffer_pos_t h = atomic_read_rx_head(), t = rx_buffer.tail;
@@ -198,6 +198,7 @@
 
     static FORCE_INLINE void atomic_set_rx_tail(ring_buffer_pos_t value);
     static FORCE_INLINE ring_buffer_pos_t atomic_read_rx_tail();
+    static FORCE_INLINE void rx_check_xon(const ring_buffer_pos_t h, const ring_buffer_pos_t t);
 
   public:
     FORCE_INLINE static void store_rxd_char();
@@ -208,6 +209,8 @@
     static void end();
     static int peek();
     static int read();
+    static int rxSpan(const uint8_t **data, const int size);
+    static void rxRelease(const int count);
     static void flush();
     static ring_buffer_pos_t available();
     static void write(const uint8_t c);
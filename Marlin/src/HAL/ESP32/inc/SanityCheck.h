@@ -40,3 +40,7 @@
 #if ENABLED(POSTMORTEM_DEBUGGING)
   #error "POSTMORTEM_DEBUGGING is not yet supported on ESP32."
 #endif
+
+#if ENABLED(SERIAL_FLOW_CREDITS)
+  #error "SERIAL_FLOW_CREDITS is not yet supported on ESP32."
+#endif
@@ -0,0 +1,49 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "BedProbe.h"
+
+BedProbe::BedProbe(pin_type probe, const LinearAxis &x, const LinearAxis &y, const LinearAxis &z, const float (&spm)[3], const float (&bed)[3])
+  : probe_pin(probe), x_axis(x), y_axis(y), z_axis(z)
+{
+  for (int i = 0; i < 3; i++) {
+    steps_per_mm[i] = spm[i];
+    plane[i] = bed[i];
+  }
+}
+
+BedProbe::~BedProbe() {
+}
+
+void BedProbe::update() {
+  const float x = (x_axis.position - x_axis.min_position) / steps_per_mm[0],
+              y = (y_axis.position - y_axis.min_position) / steps_per_mm[1],
+              z = (z_axis.position - z_axis.min_position) / steps_per_mm[2];
+  Gpio::pin_map[probe_pin].value = (z <= plane[0] + plane[1] * x + plane[2] * y);
+}
+
+void BedProbe::interrupt(GpioEvent ev) {
+  // unused
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,42 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include "Gpio.h"
+#include "LinearAxis.h"
+
+/**
+ * A tilted bed for a probe to find. The probe pin is set while the probe is
+ * at or below the plane z = z0 + dzdx * x + dzdy * y, all in mm from the
+ * point where the axis endstops trigger.
+ */
+class BedProbe: public Peripheral {
+public:
+  BedProbe(pin_type probe, const LinearAxis &x, const LinearAxis &y, const LinearAxis &z, const float (&steps_per_mm)[3], const float (&plane)[3]);
+  virtual ~BedProbe();
+  void interrupt(GpioEvent ev);
+  void update();
+
+  pin_type probe_pin;
+  const LinearAxis &x_axis, &y_axis, &z_axis;
+  float steps_per_mm[3], plane[3];
+};
@@ -47,7 +47,7 @@ void Timer::init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn) {
   frequency = sim_freq;
   cbfn = fn;
 
-  sa.sa_flags = SA_SIGINFO;
+  sa.sa_flags = SA_SIGINFO | SA_RESTART; // Restart blocking I/O interrupted by the timers
   sa.sa_sigaction = Timer::handler;
   sigemptyset(&sa.sa_mask);
   if (sigaction(SIGRTMIN, &sa, nullptr) == -1) {
@@ -20,3 +20,9 @@
  *
  */
 #pragma once
+
+// Use a card image file in place of SPI hardware
+#if NEED_SD2CARD_SPI
+  #undef NEED_SD2CARD_SPI
+  #define NEED_SD2CARD_IMAGE 1
+#endif
@@ -56,12 +56,30 @@ public:
     return buffer[mask(index_read++)];
   }
 
+  // The values from the read index up to the write index or the end of the buffer
+  uint32_t span(const T **data) volatile {
+    const uint32_t r = mask(index_read), count = available(), to_end = buffer_size - r;
+    *data = const_cast<const T*>(&buffer[r]);
+    return count < to_end ? count : to_end;
+  }
+
+  // Free values taken with span()
+  void release(const uint32_t count) volatile { index_read += count; }
+
   bool write(T value) volatile {
     if (full()) return false;
     buffer[mask(index_write++)] = value;
     return true;
   }
 
+  // Copy in as many values as fit, then publish them all at once
+  uint32_t write(const T *buf, const uint32_t size) volatile {
+    const uint32_t space = free(), count = space < size ? space : size;  // The reader may free more meanwhile
+    for (uint32_t n = 0; n < count; n++) buffer[mask(index_write + n)] = buf[n];
+    index_write += count;
+    return count;
+  }
+
 private:
   uint32_t mask(uint32_t val) volatile {
     return buffer_mask & val;
@@ -87,12 +105,24 @@ struct HalSerial {
 
   int read() { return receive_buffer.read(); }
 
+  int rxSpan(const uint8_t **data, const int size) {
+    const int n = (int)receive_buffer.span(data);
+    return n < size ? n : size;
+  }
+  void rxRelease(const int count) { receive_buffer.release(count); }
+
   size_t write(char c) {
     if (!host_connected) return 0;
     while (!transmit_buffer.free());
     return transmit_buffer.write(c);
   }
 
+  size_t write(const uint8_t *buf, size_t size) {
+    if (!host_connected) return 0;
+    for (size_t done = 0; done < size;) done += transmit_buffer.write(buf + done, size - done);
+    return size;
+  }
+
   bool connected() { return host_connected; }
 
   uint16_t available() {
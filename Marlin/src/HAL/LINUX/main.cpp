@@ -25,9 +25,13 @@
 #include "hardware/IOLoggerCSV.h"
 #include "hardware/Heater.h"
 #include "hardware/LinearAxis.h"
+#include "hardware/BedProbe.h"
 
 #include <stdio.h>
 #include <stdarg.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <unistd.h>
 #include <thread>
 #include <iostream>
 #include <fstream>
@@ -36,22 +40,28 @@ extern void setup();
 extern void loop();
 
 // simple stdout / stdin implementation for fake serial port
+// Raw read() / write() so binary transfers pass through unchanged
 void write_serial_thread() {
+  char buffer[256];
   for (;;) {
-    for (std::size_t i = usb_serial.transmit_buffer.available(); i > 0; i--) {
-      fputc(usb_serial.transmit_buffer.read(), stdout);
+    std::size_t len = 0;
+    for (std::size_t i = usb_serial.transmit_buffer.available(); i > 0 && len < sizeof(buffer); i--)
+      buffer[len++] = usb_serial.transmit_buffer.read();
+    for (std::size_t sent = 0; sent < len;) {
+      const ssize_t n = write(STDOUT_FILENO, &buffer[sent], len - sent);
+      if (n > 0) sent += n; else if (errno != EINTR) break;
     }
     std::this_thread::yield();
   }
 }
 
 void read_serial_thread() {
-  char buffer[255] = {};
+  char buffer[255];
   for (;;) {
-    std::size_t len = _MIN(usb_serial.receive_buffer.free(), 254U);
-    if (fgets(buffer, len, stdin))
-      for (std::size_t i = 0; i < strlen(buffer); i++)
-        usb_serial.receive_buffer.write(buffer[i]);
+    const std::size_t len = _MIN(usb_serial.receive_buffer.free(), sizeof(buffer));
+    const ssize_t n = len ? read(STDIN_FILENO, buffer, len) : 0;
+    for (ssize_t i = 0; i < n; i++)
+      usb_serial.receive_buffer.write(buffer[i]);
     std::this_thread::yield();
   }
 }
@@ -61,9 +71,17 @@ void simulation_loop() {
   Heater bed(HEATER_BED_PIN, TEMP_BED_PIN);
   LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN);
   LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
-  LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
+  // SIM_BED="z0,dzdx,dzdy" puts a tilted bed under the probe, which then replaces the Z endstop
+  float plane[3] = { 0 };
+  const char * const sim_bed = getenv("SIM_BED");
+  const bool has_bed = sim_bed && sscanf(sim_bed, "%f,%f,%f", &plane[0], &plane[1], &plane[2]) == 3;
+
+  LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, has_bed ? P_NC : Z_MIN_PIN, Z_MAX_PIN);
   LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
 
+  constexpr float steps_per_mm[] = DEFAULT_AXIS_STEPS_PER_UNIT;
+  BedProbe bed_probe(TERN(HAS_CUSTOM_PROBE_PIN, Z_MIN_PROBE_PIN, Z_MIN_PIN), x_axis, y_axis, z_axis, { steps_per_mm[X_AXIS], steps_per_mm[Y_AXIS], steps_per_mm[Z_AXIS] }, plane);
+
   #ifdef GPIO_LOGGING
     IOLoggerCSV logger("all_gpio_log.csv");
     Gpio::attachLogger(&logger);
@@ -83,6 +101,7 @@ void simulation_loop() {
     y_axis.update();
     z_axis.update();
     extruder0.update();
+    if (has_bed) bed_probe.update();
 
     #ifdef GPIO_LOGGING
       if (x_axis.position != x || y_axis.position != y || z_axis.position != z) {
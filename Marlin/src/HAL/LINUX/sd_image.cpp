@@ -0,0 +1,93 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+
+#if NEED_SD2CARD_IMAGE
+
+#include "../../sd/Sd2Card_image.h"
+#include "hardware/Clock.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifndef SD_IMAGE_FILE
+  #define SD_IMAGE_FILE "sdcard.img"
+#endif
+
+bool DiskIODriver_Image::init(const uint8_t, const pin_t) {
+  // Map the image again on every mount, in case it was replaced
+  if (image) {
+    munmap(image, size_t(blocks) << 9);
+    image = nullptr;
+    blocks = 0;
+  }
+
+  const char *path = getenv("SD_IMAGE_FILE") ?: SD_IMAGE_FILE;
+  int fd = open(path, O_RDWR);
+  writable = fd >= 0;
+  if (!writable) fd = open(path, O_RDONLY);
+  if (fd < 0) return false;
+
+  struct stat st;
+  if (fstat(fd, &st) == 0 && st.st_size >= 512) {
+    const size_t length = st.st_size & ~off_t(0x1FF);
+    void * const map = mmap(nullptr, length, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+    if (map != MAP_FAILED) {
+      image = static_cast<uint8_t*>(map);
+      blocks = length >> 9;
+    }
+  }
+  close(fd); // The mapping holds its own reference
+
+  read_us = write_us = stall_every = stall_us = writes = 0;
+  const char * const latency = getenv("SD_IMAGE_LATENCY");
+  if (latency) sscanf(latency, "%u,%u,%u,%u", &read_us, &write_us, &stall_every, &stall_us);
+
+  return isReady();
+}
+
+bool DiskIODriver_Image::readBlock(uint32_t block, uint8_t *dst) {
+  if (block >= blocks) return false;
+  if (read_us) Clock::delayMicros(read_us);
+  memcpy(dst, &image[size_t(block) << 9], 512);
+  return true;
+}
+
+bool DiskIODriver_Image::writeBlock(uint32_t block, const uint8_t *src) {
+  if (ENABLED(SDCARD_READONLY) || !writable || block >= blocks) return false;
+  if (write_us) Clock::delayMicros(write_us);
+  if (stall_every && ++writes >= stall_every) {
+    writes = 0;
+    Clock::delayMicros(stall_us);
+  }
+  memcpy(&image[size_t(block) << 9], src, 512);
+  return true;
+}
+
+#endif // NEED_SD2CARD_IMAGE
+#endif // __PLAT_LINUX__
@@ -54,3 +54,7 @@
 #if ENABLED(POSTMORTEM_DEBUGGING)
   #error "POSTMORTEM_DEBUGGING is not yet supported on AGCM4."
 #endif
+
+#if ENABLED(SERIAL_FLOW_CREDITS)
+  #error "SERIAL_FLOW_CREDITS is not yet supported on SAMD51."
+#endif
@@ -55,3 +55,7 @@
 #if ANY(TFT_COLOR_UI, TFT_LVGL_UI, TFT_CLASSIC_UI) && NOT_TARGET(STM32H7xx, STM32F4xx, STM32F1xx)
   #error "TFT_COLOR_UI, TFT_LVGL_UI and TFT_CLASSIC_UI are currently only supported on STM32H7, STM32F4 and STM32F1 hardware."
 #endif
+
+#if ENABLED(SERIAL_FLOW_CREDITS)
+  #error "SERIAL_FLOW_CREDITS is not yet supported on STM32."
+#endif
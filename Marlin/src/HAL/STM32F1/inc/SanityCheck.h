@@ -49,3 +49,7 @@
 #if ENABLED(EMERGENCY_PARSER) && !defined(USE_USB_COMPOSITE) && ((SERIAL_PORT == -1 && !defined(SERIAL_PORT_2)) || (SERIAL_PORT_2 == -1 && !defined(SERIAL_PORT)))
   #error "EMERGENCY_PARSER is only supported by HardwareSerial or USBComposite in HAL/STM32F1."
 #endif
+
+#if ENABLED(SERIAL_FLOW_CREDITS)
+  #error "SERIAL_FLOW_CREDITS is not yet supported on the STM32F1 platform."
+#endif
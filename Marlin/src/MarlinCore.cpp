@@ -762,6 +762,22 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
   // Handle SD Card insert / remove
   TERN_(SDSUPPORT, card.manage_media());
 
+  // Read ahead the file being printed
+  #if SD_READ_AHEAD
+    card.read_ahead();
+  #endif
+
+  // Build or follow the layer index of the file being printed
+  TERN_(SD_PRINT_INDEX, print_index.task());
+
+  // Write buffered log lines to the card
+  TERN_(SD_LOG_BUFFER, card.log_task());
+
+  // Write the latest power-loss recovery record
+  #if ENABLED(POWER_LOSS_RECOVERY) && POWER_LOSS_RECOVERY_SLOTS
+    recovery.task();
+  #endif
+
   // Handle USB Flash Drive insert / remove
   TERN_(USB_FLASH_DRIVE_SUPPORT, card.diskIODriver()->idle());
 
@@ -811,6 +827,17 @@ void idle(TERN_(ADVANCED_PAUSE_FEATURE, bool no_stepper_sleep/*=false*/)) {
   // Update the LVGL interface
   TERN_(HAS_TFT_LVGL_UI, LV_TASK_HANDLER());
 
+  // Send buffered serial output, including lines held for a streaming host every few ms
+  #if SERIAL_OUTPUT_BUFFER
+  {
+    static millis_t held_output_ms;
+    const millis_t ms = millis();
+    const bool held = ELAPSED(ms, held_output_ms);
+    if (held) held_output_ms = ms + 10;
+    SERIAL_FLUSH_OUTPUT(held);
+  }
+  #endif
+
   IDLE_DONE:
   TERN_(MARLIN_DEV_MODE, idle_depth--);
   return;
@@ -848,6 +875,10 @@ void kill(PGM_P const lcd_error/*=nullptr*/, PGM_P const lcd_component/*=nullptr
 
 void minkill(const bool steppers_off/*=false*/) {
 
+  #if SERIAL_OUTPUT_BUFFER
+    SERIAL_FLUSH_OUTPUT();
+  #endif
+
   // Wait a short time (allows messages to get out before shutting down.
   for (int i = 1000; i--;) DELAY_US(600);
 
@@ -1238,6 +1269,10 @@ void setup() {
     SETUP_RUN(probe.tare_init());
   #endif
 
+  #if ENABLED(SCARA_TRIG_TABLE)
+    SETUP_RUN(scara_trig_init());     // Fill the trig tables before any kinematics
+  #endif
+
   #if BOTH(SDSUPPORT, SDCARD_EEPROM_EMULATION)
     SETUP_RUN(card.mount());          // Mount media with settings before first_load
   #endif
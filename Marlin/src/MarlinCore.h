@@ -66,8 +66,9 @@ enum MarlinState : uint8_t {
 };
 
 extern MarlinState marlin_state;
-inline bool IsRunning() { return marlin_state == MF_RUNNING; }
-inline bool IsStopped() { return marlin_state != MF_RUNNING; }
+// Commands read before the end of an SD print still run until M1001 is queued
+inline bool IsRunning() { return marlin_state == MF_RUNNING || marlin_state == MF_SD_COMPLETE; }
+inline bool IsStopped() { return !IsRunning(); }
 
 bool printingIsActive();
 bool printingIsPaused();
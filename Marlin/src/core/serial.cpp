@@ -66,7 +66,11 @@ PGMSTR(SP_X_LBL, " X:"); PGMSTR(SP_Y_LBL, " Y:"); PGMSTR(SP_Z_LBL, " Z:"); PGMST
 #endif
 
 void serialprintPGM(PGM_P str) {
-  while (const char c = pgm_read_byte(str++)) SERIAL_CHAR(c);
+  #ifdef __AVR__
+    while (const char c = pgm_read_byte(str++)) SERIAL_CHAR(c);
+  #else
+    SERIAL_IMPL.print(str);   // Flash is in the address space, so write it as a block
+  #endif
 }
 
 void serial_echo_start()  { static PGMSTR(echomagic, "echo:"); serialprintPGM(echomagic); }
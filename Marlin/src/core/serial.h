@@ -178,6 +178,11 @@ void SERIAL_PRINTLN(T x, U y) { SERIAL_IMPL.println(x, y); }
 // Flush the serial port
 inline void SERIAL_FLUSH()    { SERIAL_IMPL.flush(); }
 inline void SERIAL_FLUSHTX()  { SERIAL_IMPL.flushTX(); }
+#if SERIAL_OUTPUT_BUFFER
+  // Pass on buffered output. With held=false, lines held for a streaming host stay put.
+  inline void SERIAL_FLUSH_OUTPUT(const bool held=true) { CALL_IF_EXISTS(void, &SERIAL_IMPL, flushOutput, held); }
+  inline void SERIAL_HOLD_OUTPUT(const serial_index_t index, const bool hold) { CALL_IF_EXISTS(void, &SERIAL_IMPL, holdOutput, index, hold); }
+#endif
 
 // Print a single PROGMEM string to serial
 void serialprintPGM(PGM_P str);
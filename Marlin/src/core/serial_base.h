@@ -69,6 +69,12 @@ ENUM_FLAGS(SerialFeature);
 CALL_IF_EXISTS_IMPL(void, flushTX);
 CALL_IF_EXISTS_IMPL(bool, connected, true);
 CALL_IF_EXISTS_IMPL(SerialFeature, features, SerialFeature::None);
+CALL_IF_EXISTS_IMPL(int, rxSpan, 0);
+CALL_IF_EXISTS_IMPL(void, rxRelease);
+#if SERIAL_OUTPUT_BUFFER
+  CALL_IF_EXISTS_IMPL(void, flushOutput);
+  CALL_IF_EXISTS_IMPL(void, holdOutput);
+#endif
 
 // A simple forward struct to prevent the compiler from selecting print(double, int) as a default overload
 // for any type other than double/float. For double/float, a conversion exists so the call will be invisible.
@@ -119,6 +125,20 @@ struct SerialBase {
       @param index  The port index, usually 0 */
   int read(serial_index_t index=0)        { return SerialChild->read(index); }
 
+  /** Get the bytes waiting at the start of the RX buffer, to read them in place.
+      They stay in the buffer until rxRelease. Serial classes with direct access
+      to their buffer may provide this. The others return 0, so use read().
+      @param index  The port index, usually 0
+      @param data   Receives a pointer to the bytes
+      @param size   The most bytes to take
+      @return       The number of bytes at *data */
+  int rxSpan(serial_index_t, const uint8_t **, const int) { return 0; }
+
+  /** Free bytes from the start of the RX buffer, after rxSpan
+      @param index  The port index, usually 0
+      @param count  The number of bytes */
+  void rxRelease(serial_index_t, const int) {}
+
   /** Combine the features of this serial instance and return it
       @param index  The port index, usually 0 */
   SerialFeature features(serial_index_t index=0) const { return static_cast<const Child*>(this)->features(index);  }
@@ -135,9 +155,11 @@ struct SerialBase {
   // Not all implementation have a flushTX, so let's call them only if the child has the implementation
   void flushTX()                    { CALL_IF_EXISTS(void, SerialChild, flushTX); }
 
+  // Write a block of bytes at once. Each serial class passes it on to the next.
+  void write(const uint8_t *buffer, size_t size) { SerialChild->write(buffer, size); }
+
   // Glue code here
-  FORCE_INLINE void write(const char *str)                    { while (*str) write(*str++); }
-  FORCE_INLINE void write(const uint8_t *buffer, size_t size) { while (size--) write(*buffer++); }
+  FORCE_INLINE void write(const char *str)                    { write((const uint8_t*)str, strlen(str)); }
   FORCE_INLINE void print(const char *str)                    { write(str); }
   // No default argument to avoid ambiguity
   NO_INLINE void print(char c, PrintBase base)                { printNumber((signed long)c, (uint8_t)base); }
@@ -181,13 +203,14 @@ struct SerialBase {
     if (!base) return; // Hopefully, this should raise visible bug immediately
 
     if (n) {
-      unsigned char buf[8 * sizeof(long)]; // Enough space for base 2
-      int8_t i = 0;
+      uint8_t buf[8 * sizeof(long)]; // Enough space for base 2
+      uint8_t i = sizeof(buf);
       while (n) {
-        buf[i++] = n % base;
+        const uint8_t d = n % base;
+        buf[--i] = d + (d < 10 ? '0' : 'A' - 10);
         n /= base;
       }
-      while (i--) write((char)(buf[i] + (buf[i] < 10 ? '0' : 'A' - 10)));
+      write(&buf[i], sizeof(buf) - i);
     }
     else write('0');
   }
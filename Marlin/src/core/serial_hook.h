@@ -48,6 +48,40 @@ public:
   static constexpr uint8_t All = 0xFF;
 };
 
+namespace Private {
+  // Pass a block to the underlying serial class's write(buffer, size) if it has one, or write it byte by byte
+  template <class SerialT>
+  FORCE_INLINE auto WriteBlock(SerialT * const out, const uint8_t *buffer, size_t size, int) -> decltype(out->write(buffer, size), void()) { out->write(buffer, size); }
+  template <class SerialT>
+  FORCE_INLINE void WriteBlock(SerialT * const out, const uint8_t *buffer, size_t size, long) { while (size--) out->write(*buffer++); }
+  template <class SerialT>
+  FORCE_INLINE void WriteBlock(SerialT * const out, const uint8_t *buffer, size_t size) { WriteBlock(out, buffer, size, 0); }
+}
+
+#if SERIAL_OUTPUT_BUFFER
+  // Output collected for a serial port and passed on a line at a time
+  struct SerialOutputBuffer {
+    uint8_t data[SERIAL_OUTPUT_BUFFER];
+    uint8_t count;
+    bool hold;  // Keep whole lines too, until flush(held=true), so they go out together
+
+    template <class SerialT>
+    FORCE_INLINE void put(SerialT * const out, const uint8_t c) {
+      data[count++] = c;
+      if (count == sizeof(data) || (c == '\n' && !hold)) flush(out);
+    }
+    template <class SerialT>
+    void flush(SerialT * const out, const bool held=true) {
+      if (count && (held || !hold)) {
+        Private::WriteBlock(out, data, count);
+        count = 0;
+      }
+    }
+
+    SerialOutputBuffer() : count(0), hold(false) {}
+  };
+#endif
+
 // The most basic serial class: it dispatch to the base serial class with no hook whatsoever. This will compile to nothing but the base serial class
 template <class SerialT>
 struct BaseSerial : public SerialBase< BaseSerial<SerialT> >, public SerialT {
@@ -57,13 +91,32 @@ struct BaseSerial : public SerialBase< BaseSerial<SerialT> >, public SerialT {
   using SerialT::write;
   using SerialT::flush;
 
+  #if SERIAL_OUTPUT_BUFFER
+    SerialOutputBuffer outBuffer;
+    size_t write(uint8_t c)                     { outBuffer.put(static_cast<SerialT*>(this), c); return 1; }
+    size_t write(char c)                        { return write(uint8_t(c)); } // Not the HAL's write(char), which skips the buffer
+    void write(const uint8_t *buffer, size_t size) { while (size--) write(*buffer++); }
+    void flushOutput(const bool held=true)      { outBuffer.flush(static_cast<SerialT*>(this), held); }
+    void holdOutput(serial_index_t, const bool hold) { outBuffer.hold = hold; if (!hold) flushOutput(); }
+  #else
+    void write(const uint8_t *buffer, size_t size) { Private::WriteBlock(static_cast<SerialT*>(this), buffer, size); }
+  #endif
+
   void msgDone() {}
 
   // We don't care about indices here, since if one can call us, it's the right index anyway
   int available(serial_index_t) { return (int)SerialT::available(); }
   int read(serial_index_t)      { return (int)SerialT::read(); }
+  // Read in place from the HAL RX buffer if it allows it
+  int rxSpan(serial_index_t, const uint8_t **data, const int size) { return CALL_IF_EXISTS(int, static_cast<SerialT*>(this), rxSpan, data, size); }
+  void rxRelease(serial_index_t, const int count) { CALL_IF_EXISTS(void, static_cast<SerialT*>(this), rxRelease, count); }
   bool connected()              { return CALL_IF_EXISTS(bool, static_cast<SerialT*>(this), connected);; }
-  void flushTX()                { CALL_IF_EXISTS(void, static_cast<SerialT*>(this), flushTX); }
+  void flushTX() {
+    #if SERIAL_OUTPUT_BUFFER
+      flushOutput();
+    #endif
+    CALL_IF_EXISTS(void, static_cast<SerialT*>(this), flushTX);
+  }
 
   SerialFeature features(serial_index_t index) const { return CALL_IF_EXISTS(SerialFeature, static_cast<const SerialT*>(this), features, index);  }
 
@@ -92,6 +145,7 @@ struct ConditionalSerial : public SerialBase< ConditionalSerial<SerialT> > {
   bool    & condition;
   SerialT & out;
   NO_INLINE size_t write(uint8_t c) { if (condition) return out.write(c); return 0; }
+  void write(const uint8_t *buffer, size_t size) { if (condition) Private::WriteBlock(&out, buffer, size); }
   void flush()                      { if (condition) out.flush();  }
   void begin(long br)               { out.begin(br); }
   void end()                        { out.end(); }
@@ -115,7 +169,16 @@ struct ForwardSerial : public SerialBase< ForwardSerial<SerialT> > {
   typedef SerialBase< ForwardSerial<SerialT> > BaseClassT;
 
   SerialT & out;
-  NO_INLINE size_t write(uint8_t c) { return out.write(c); }
+  #if SERIAL_OUTPUT_BUFFER
+    SerialOutputBuffer outBuffer;
+    size_t write(uint8_t c)                     { outBuffer.put(&out, c); return 1; }
+    void write(const uint8_t *buffer, size_t size) { while (size--) write(*buffer++); }
+    void flushOutput(const bool held=true)      { outBuffer.flush(&out, held); }
+    void holdOutput(serial_index_t, const bool hold) { outBuffer.hold = hold; if (!hold) flushOutput(); }
+  #else
+    NO_INLINE size_t write(uint8_t c) { return out.write(c); }
+    void write(const uint8_t *buffer, size_t size) { Private::WriteBlock(&out, buffer, size); }
+  #endif
   void flush()            { out.flush();  }
   void begin(long br)     { out.begin(br); }
   void end()              { out.end(); }
@@ -123,7 +186,12 @@ struct ForwardSerial : public SerialBase< ForwardSerial<SerialT> > {
   void msgDone() {}
   // Existing instances implement Arduino's operator bool, so use that if it's available
   bool connected()              { return Private::HasMember_connected<SerialT>::value ? CALL_IF_EXISTS(bool, &out, connected) : (bool)out; }
-  void flushTX()                { CALL_IF_EXISTS(void, &out, flushTX); }
+  void flushTX() {
+    #if SERIAL_OUTPUT_BUFFER
+      flushOutput();
+    #endif
+    CALL_IF_EXISTS(void, &out, flushTX);
+  }
 
   int available(serial_index_t) { return (int)out.available(); }
   int read(serial_index_t)      { return (int)out.read(); }
@@ -147,15 +215,35 @@ struct RuntimeSerial : public SerialBase< RuntimeSerial<SerialT> >, public Seria
 
   NO_INLINE size_t write(uint8_t c) {
     if (writeHook) writeHook(userPointer, c);
-    return SerialT::write(c);
+    #if SERIAL_OUTPUT_BUFFER
+      outBuffer.put(static_cast<SerialT*>(this), c);
+      return 1;
+    #else
+      return SerialT::write(c);
+    #endif
+  }
+
+  void write(const uint8_t *buffer, size_t size) {
+    #if !SERIAL_OUTPUT_BUFFER
+      if (!writeHook) return Private::WriteBlock(static_cast<SerialT*>(this), buffer, size);
+    #endif
+    while (size--) write(*buffer++);
   }
 
+  #if SERIAL_OUTPUT_BUFFER
+    SerialOutputBuffer outBuffer;
+    void flushOutput(const bool held=true)      { outBuffer.flush(static_cast<SerialT*>(this), held); }
+    void holdOutput(serial_index_t, const bool hold) { outBuffer.hold = hold; if (!hold) flushOutput(); }
+  #endif
+
   NO_INLINE void msgDone() {
     if (eofHook) eofHook(userPointer);
   }
 
   int available(serial_index_t)  { return (int)SerialT::available(); }
   int read(serial_index_t)       { return (int)SerialT::read(); }
+  int rxSpan(serial_index_t, const uint8_t **data, const int size) { return CALL_IF_EXISTS(int, static_cast<SerialT*>(this), rxSpan, data, size); }
+  void rxRelease(serial_index_t, const int count) { CALL_IF_EXISTS(void, static_cast<SerialT*>(this), rxRelease, count); }
   using SerialT::available;
   using SerialT::read;
   using SerialT::flush;
@@ -172,7 +260,12 @@ struct RuntimeSerial : public SerialBase< RuntimeSerial<SerialT> >, public Seria
       : static_cast<SerialT*>(this)->operator bool();
   }
 
-  void flushTX() { CALL_IF_EXISTS(void, static_cast<SerialT*>(this), flushTX); }
+  void flushTX() {
+    #if SERIAL_OUTPUT_BUFFER
+      flushOutput();
+    #endif
+    CALL_IF_EXISTS(void, static_cast<SerialT*>(this), flushTX);
+  }
 
   // Append Hookable for this class
   SerialFeature features(serial_index_t index) const  { return SerialFeature::Hookable | CALL_IF_EXISTS(SerialFeature, static_cast<const SerialT*>(this), features, index);  }
@@ -226,6 +319,25 @@ struct MultiSerial : public SerialBase< MultiSerial< REPEAT(NUM_SERIAL, _S_NAME)
     REPEAT(NUM_SERIAL, _S_WRITE);
     #undef _S_WRITE
   }
+  void write(const uint8_t *buffer, size_t size) {
+    #define _S_WRITEBLOCK(N) if (portMask.enabled(output[N])) serial##N.write(buffer, size);
+    REPEAT(NUM_SERIAL, _S_WRITEBLOCK);
+    #undef _S_WRITEBLOCK
+  }
+  #if SERIAL_OUTPUT_BUFFER
+    // Pass on the output of all ports, not just the current ones
+    void flushOutput(const bool held=true) {
+      #define _S_FLUSHOUTPUT(N) CALL_IF_EXISTS(void, &serial##N, flushOutput, held);
+      REPEAT(NUM_SERIAL, _S_FLUSHOUTPUT);
+      #undef _S_FLUSHOUTPUT
+    }
+    void holdOutput(serial_index_t index, const bool hold) {
+      uint8_t pos = offset;
+      #define _S_HOLDOUTPUT(N) if (index.within(pos, pos + step - 1)) return CALL_IF_EXISTS(void, &serial##N, holdOutput, index, hold); else pos += step;
+      REPEAT(NUM_SERIAL, _S_HOLDOUTPUT);
+      #undef _S_HOLDOUTPUT
+    }
+  #endif
   NO_INLINE void msgDone() {
     #define _S_DONE(N) if (portMask.enabled(output[N])) serial##N.msgDone();
     REPEAT(NUM_SERIAL, _S_DONE);
@@ -245,6 +357,19 @@ struct MultiSerial : public SerialBase< MultiSerial< REPEAT(NUM_SERIAL, _S_NAME)
     #undef _S_READ
     return -1;
   }
+  int rxSpan(serial_index_t index, const uint8_t **data, const int size) {
+    uint8_t pos = offset;
+    #define _S_RXSPAN(N) if (index.within(pos, pos + step - 1)) return serial##N.rxSpan(index, data, size); else pos += step;
+    REPEAT(NUM_SERIAL, _S_RXSPAN);
+    #undef _S_RXSPAN
+    return 0;
+  }
+  void rxRelease(serial_index_t index, const int count) {
+    uint8_t pos = offset;
+    #define _S_RXRELEASE(N) if (index.within(pos, pos + step - 1)) return serial##N.rxRelease(index, count); else pos += step;
+    REPEAT(NUM_SERIAL, _S_RXRELEASE);
+    #undef _S_RXRELEASE
+  }
   void begin(const long br) {
     #define _S_BEGIN(N) if (portMask.enabled(output[N])) serial##N.begin(br);
     REPEAT(NUM_SERIAL, _S_BEGIN);
@@ -21,7 +21,7 @@
 
 #include "../../inc/MarlinConfig.h"
 
-#if ENABLED(UBL_HILBERT_CURVE)
+#if EITHER(UBL_HILBERT_CURVE, PROBE_PATH_OPTIMIZER)
 
 #include "bedlevel.h"
 #include "hilbert_curve.h"
@@ -96,6 +96,8 @@ bool hilbert_curve::search_from(uint8_t x, uint8_t y, hilbert_curve::callback_pt
   return search(search_from_helper, &d) || search(search_from_helper, &d);
 }
 
+#if ENABLED(UBL_HILBERT_CURVE)
+
 /**
  * Like search_from, but takes a bed position and starts from the nearest
  * point on the Hilbert curve.
@@ -108,3 +110,5 @@ bool hilbert_curve::search_from_closest(const xy_pos_t &pos, hilbert_curve::call
 }
 
 #endif // UBL_HILBERT_CURVE
+
+#endif // UBL_HILBERT_CURVE || PROBE_PATH_OPTIMIZER
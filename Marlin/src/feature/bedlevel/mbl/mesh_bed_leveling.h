@@ -23,6 +23,10 @@
 
 #include "../../../inc/MarlinConfig.h"
 
+#if ENABLED(PROBE_PATH_OPTIMIZER)
+  #include "../probe_path.h"
+#endif
+
 enum MeshLevelingState : char {
   MeshReport,     // G29 S0
   MeshStart,      // G29 S1
@@ -59,9 +63,14 @@ public:
   static void set_z(const int8_t px, const int8_t py, const_float_t z) { z_values[px][py] = z; }
 
   static inline void zigzag(const int8_t index, int8_t &px, int8_t &py) {
-    px = index % (GRID_MAX_POINTS_X);
-    py = index / (GRID_MAX_POINTS_X);
-    if (py & 1) px = (GRID_MAX_POINTS_X) - 1 - px; // Zig zag
+    #if ENABLED(PROBE_PATH_OPTIMIZER)
+      const xy_uint8_t ij = probe_path.point(index); // Order planned by G29 S2
+      px = ij.x; py = ij.y;
+    #else
+      px = index % (GRID_MAX_POINTS_X);
+      py = index / (GRID_MAX_POINTS_X);
+      if (py & 1) px = (GRID_MAX_POINTS_X) - 1 - px; // Zig zag
+    #endif
   }
 
   static void set_zigzag_z(const int8_t index, const_float_t z) {
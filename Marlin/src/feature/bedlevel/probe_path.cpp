@@ -0,0 +1,177 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * probe_path.cpp - Travel-minimizing probe order for G29
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(PROBE_PATH_OPTIMIZER)
+
+#include "probe_path.h"
+#include "hilbert_curve.h"
+
+#include "../../MarlinCore.h"
+#include "../../module/motion.h"
+#include "../../module/planner.h"
+
+#define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
+#include "../../core/debug_out.h"
+
+ProbePath probe_path;
+
+probe_path_index_t ProbePath::count,
+                   ProbePath::order[GRID_MAX_POINTS];
+xy_uint8_t ProbePath::grid;
+xy_pos_t ProbePath::origin, ProbePath::start;
+xy_float_t ProbePath::spacing;
+float ProbePath::feedrate_mm_s, ProbePath::accel_mm_s2;
+
+static ProbePath::filter_ptr path_filter;
+
+/**
+ * Estimated time (s) for a straight move with a trapezoidal (or triangular)
+ * velocity profile, starting and ending at rest.
+ */
+float ProbePath::move_time(const xy_pos_t &a, const xy_pos_t &b) {
+  const float d = (b - a).magnitude();
+  if (d < 0.001f) return 0;
+  const float v = feedrate_mm_s, ac = accel_mm_s2;
+  return d < sq(v) / ac ? 2 * SQRT(d / ac) : d / v + v / ac;
+}
+
+// Cost of the move from path point n1 to n2. Point -1 is the start position.
+// There is no move after the last point of the path.
+float ProbePath::cost(const int16_t n1, const int16_t n2) {
+  if (n2 >= count) return 0;
+  return move_time(n1 < 0 ? start : position(order[n1]), position(order[n2]));
+}
+
+float ProbePath::path_time() {
+  float t = 0;
+  for (int16_t n = 0; n < count; ++n) t += cost(n - 1, n);
+  return t;
+}
+
+static inline void swap_points(probe_path_index_t &a, probe_path_index_t &b) {
+  const probe_path_index_t t = a; a = b; b = t;
+}
+
+static inline bool include_point(const xy_uint8_t &grid, const uint8_t i, const uint8_t j, const xy_pos_t &pos) {
+  return i < grid.x && j < grid.y && (!path_filter || path_filter(i, j, pos));
+}
+
+// Row-by-row zig-zag, as used by the classic G29 implementations
+void ProbePath::seed_serpentine() {
+  count = 0;
+  LOOP_L_N(j, grid.y) LOOP_L_N(ii, grid.x) {
+    const uint8_t i = (j & 1) ? grid.x - 1 - ii : ii;
+    const probe_path_index_t ind = j * grid.x + i;
+    if (include_point(grid, i, j, position(ind))) order[count++] = ind;
+  }
+}
+
+void ProbePath::seed_hilbert() {
+  count = 0;
+  hilbert_curve::search([](uint8_t i, uint8_t j, void*) {
+    const probe_path_index_t ind = j * grid.x + i;
+    if (include_point(grid, i, j, position(ind))) order[count++] = ind;
+    return false;
+  }, nullptr);
+
+  // Walk the curve from whichever end is closer to the start position
+  if (count && move_time(start, position(order[count - 1])) < move_time(start, position(order[0])))
+    for (probe_path_index_t a = 0, b = count - 1; a < b; ++a, --b) swap_points(order[a], order[b]);
+}
+
+// Greedy walk to the closest remaining point, reordering the current point set in place
+void ProbePath::seed_nearest() {
+  for (probe_path_index_t n = 0; n < count; ++n) {
+    const xy_pos_t from = n ? position(order[n - 1]) : start;
+    probe_path_index_t best = n;
+    float best_t = 99999.99f;
+    for (probe_path_index_t m = n; m < count; ++m) {
+      const float t = move_time(from, position(order[m]));
+      if (t < best_t) { best_t = t; best = m; }
+    }
+    swap_points(order[n], order[best]);
+  }
+}
+
+/**
+ * 2-opt refinement: Reverse any sub-path whose reversal shortens the total
+ * travel time. The start position is fixed and the end of the path is free.
+ */
+void ProbePath::two_opt() {
+  LOOP_L_N(pass, PROBE_PATH_2OPT_PASSES) {
+    bool improved = false;
+    for (int16_t i = 0; i < int16_t(count) - 1; ++i) {
+      for (int16_t j = i + 1; j < count; ++j) {
+        const float delta = cost(i - 1, j) + cost(i, j + 1) - cost(i - 1, i) - cost(j, j + 1);
+        if (delta < -0.0001f) {
+          for (int16_t a = i, b = j; a < b; ++a, --b) swap_points(order[a], order[b]);
+          improved = true;
+        }
+      }
+      idle_no_sleep();
+    }
+    if (!improved) break;
+  }
+}
+
+probe_path_index_t ProbePath::plan(const xy_uint8_t &in_grid, const xy_pos_t &in_origin, const xy_float_t &in_spacing, const xy_pos_t &in_start, filter_ptr filter/*=nullptr*/) {
+  grid = in_grid;
+  origin = in_origin;
+  spacing = in_spacing;
+  start = in_start;
+  path_filter = filter;
+  feedrate_mm_s = XY_PROBE_FEEDRATE_MM_S;
+  accel_mm_s2 = _MAX(planner.settings.travel_acceleration, 1.0f);
+
+  // Evaluate both seeds and keep the faster one
+  seed_hilbert();
+  const float hilbert_time = path_time();
+  seed_nearest();
+  const float nearest_time = path_time();
+  if (hilbert_time < nearest_time) seed_hilbert();
+
+  #if ENABLED(DEBUG_LEVELING_FEATURE)
+    if (DEBUGGING(LEVELING)) {
+      // Time a serpentine path for comparison, then put back the chosen seed
+      probe_path_index_t seeded[GRID_MAX_POINTS];
+      memcpy(seeded, order, sizeof(order));
+      seed_serpentine();
+      const float serpentine_time = path_time();
+      memcpy(order, seeded, sizeof(order));
+      DEBUG_ECHOLNPAIR("Probe path (", count, " points) serpentine:", serpentine_time, "s hilbert:", hilbert_time, "s nearest:", nearest_time, "s");
+    }
+  #endif
+
+  two_opt();
+
+  if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPAIR("Probe path 2-opt:", path_time(), "s");
+
+  return count;
+}
+
+#endif // PROBE_PATH_OPTIMIZER
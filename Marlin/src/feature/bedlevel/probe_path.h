@@ -0,0 +1,81 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * probe_path.h - Travel-minimizing probe order for G29
+ *
+ * Shared by ABL, MBL and UBL to visit a set of mesh points in an order that
+ * minimizes the estimated travel time between probes. A Hilbert curve and a
+ * nearest-neighbor walk are both used as seeds. The better of the two is then
+ * refined with 2-opt, using a trapezoidal move-time estimate for the cost.
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if GRID_MAX_POINTS > 255
+  typedef uint16_t probe_path_index_t;
+#else
+  typedef uint8_t probe_path_index_t;
+#endif
+
+class ProbePath {
+public:
+  // Return 'true' to include the mesh point (i, j) located at 'pos'
+  typedef bool (*filter_ptr)(const uint8_t i, const uint8_t j, const xy_pos_t &pos);
+
+  static probe_path_index_t count;                // Number of points in the planned path
+
+  /**
+   * Plan a path over the grid points (i, j) < 'grid' which pass 'filter'.
+   * Point (i, j) is located at 'origin' + 'spacing' * (i, j), and 'start'
+   * is the position of the probe (or nozzle) before the first move.
+   * Returns the number of points in the path.
+   */
+  static probe_path_index_t plan(const xy_uint8_t &grid, const xy_pos_t &origin, const xy_float_t &spacing, const xy_pos_t &start, filter_ptr filter=nullptr);
+
+  // Grid indexes of the n-th point in the planned path
+  static xy_uint8_t point(const probe_path_index_t n) {
+    const probe_path_index_t ind = order[n];
+    return { uint8_t(ind % grid.x), uint8_t(ind / grid.x) };
+  }
+
+private:
+  static probe_path_index_t order[GRID_MAX_POINTS];
+  static xy_uint8_t grid;
+  static xy_pos_t origin, start;
+  static xy_float_t spacing;
+  static float feedrate_mm_s, accel_mm_s2;
+
+  static xy_pos_t position(const probe_path_index_t ind) {
+    return origin + spacing * xy_float_t({ float(ind % grid.x), float(ind / grid.x) });
+  }
+  static float move_time(const xy_pos_t &a, const xy_pos_t &b);
+  static float cost(const int16_t n1, const int16_t n2);
+  static float path_time();
+  static void seed_serpentine();
+  static void seed_hilbert();
+  static void seed_nearest();
+  static void two_opt();
+};
+
+extern ProbePath probe_path;
@@ -0,0 +1,182 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * probe_scan.cpp - Fly-by mesh scanning
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(PROBE_FLYBY_SCAN)
+
+#include "probe_scan.h"
+
+#include "../../module/endstops.h"
+#include "../../module/motion.h"
+#include "../../module/planner.h"
+#include "../../module/probe.h"
+
+#define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
+#include "../../core/debug_out.h"
+
+ProbeScan probe_scan;
+
+// Distance from a point to the nearest contour of the previous pass, in
+// 1/64ths of the X spacing. Points above the scan range are skipped.
+#define GAP_UNITS 64
+#define GAP_NONE  255
+#define GAP_SKIP  254
+
+uint16_t ProbeScan::scan_mesh(bed_mesh_t &z, const xy_pos_t &origin, const xy_float_t &spacing) {
+  const millis_t scan_start_ms = millis();
+
+  auto mesh_pos = [&](const uint8_t i, const uint8_t j) -> xy_pos_t {
+    return origin + spacing * xy_float_t({ float(i), float(j) });
+  };
+
+  uint8_t gap[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+  memset(gap, GAP_NONE, sizeof(gap));
+
+  auto is_wanted = [&](const uint8_t i, const uint8_t j) {
+    return isnan(z[i][j]) && gap[i][j] != GAP_SKIP && probe.can_reach(mesh_pos(i, j));
+  };
+
+  // Count the reachable points to be found
+  uint16_t wanted = 0, found = 0;
+  GRID_LOOP(i, j) if (is_wanted(i, j)) wanted++;
+  if (!wanted) return 0;
+
+  // Probe the center of the mesh to find a reference height
+  const float z_ref = probe.probe_at_point(mesh_pos((GRID_MAX_POINTS_X) / 2, (GRID_MAX_POINTS_Y) / 2), PROBE_PT_RAISE);
+  if (isnan(z_ref)) return 0;
+
+  const float x_margin = spacing.x * 0.5f,
+              gap_unit = spacing.x / (GAP_UNITS),
+              h_top = z_ref + (PROBE_SCAN_RANGE),
+              clear_z = h_top + Z_CLEARANCE_MULTI_PROBE - probe.offset.z;   // Nozzle Z to travel over points already found
+  const feedRate_t scan_fr_mm_s = MMM_TO_MMS(PROBE_SCAN_FEEDRATE);
+
+  /**
+   * Step down in Z. A point takes the height of the first pass that triggers over it.
+   * Each pass only sweeps runs of points still to be found, and lifts between them, so
+   * the probe never passes over a found point lower than where it triggered there.
+   *
+   * The edges of the triggered spans are the contours of the bed at the pass height.
+   * A point's height is interpolated between the nearest contour of its pass and the
+   * nearest contour of the pass before. Without both it's the middle of the step.
+   * A point that triggers on the first pass is above the scan range and is left for
+   * normal probing.
+   */
+  for (float h = h_top; h >= z_ref - (PROBE_SCAN_RANGE) - 0.0001f && found < wanted; h -= PROBE_SCAN_Z_STEP) {
+
+    const bool first_pass = (h == h_top);
+    const float nozzle_z = h - probe.offset.z;      // Nozzle Z with the probe at height 'h'
+
+    LOOP_L_N(j, GRID_MAX_POINTS_Y) {
+      const bool reverse = j & 1;                   // Zig-zag
+
+      for (uint8_t n = 0; n < GRID_MAX_POINTS_X; ) {
+        // Find the next run of points to be found, in the direction of travel
+        const uint8_t ia = reverse ? GRID_MAX_POINTS_X - 1 - n : n;
+        if (!is_wanted(ia, j)) { n++; continue; }
+        uint8_t ib = ia;
+        for (n++; n < GRID_MAX_POINTS_X; n++) {
+          const uint8_t i = reverse ? GRID_MAX_POINTS_X - 1 - n : n;
+          if (!is_wanted(i, j)) break;
+          ib = i;
+        }
+        const uint8_t ilo = _MIN(ia, ib), ihi = _MAX(ia, ib);
+
+        const float y = mesh_pos(0, j).y;
+        xy_pos_t pa = { _MAX(mesh_pos(ilo, j).x - x_margin, probe.min_x()), y },
+                 pb = { _MIN(mesh_pos(ihi, j).x + x_margin, probe.max_x()), y };
+        if (reverse) { const xy_pos_t t = pa; pa = pb; pb = t; }
+
+        // Move to the run start over any found points, then lower to the pass height
+        if (current_position.z < clear_z) do_blocking_move_to_z(clear_z, z_probe_fast_mm_s);
+        do_blocking_move_to_xy(pa - probe.offset_xy, XY_PROBE_FEEDRATE_MM_S);
+        do_blocking_move_to_z(nozzle_z, z_probe_fast_mm_s);
+
+        // Sweep the run while latching probe edges
+        endstops.scan_start();
+        const bool start_state = endstops.scan_state;
+        do_blocking_move_to_xy(pb - probe.offset_xy, scan_fr_mm_s);
+        endstops.scan_stop();
+
+        // Lift clear of the run before going on
+        do_blocking_move_to_z(clear_z, z_probe_fast_mm_s);
+
+        if (endstops.scan_overflow) {
+          if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPAIR("Scan overflow in row ", j);
+          for (uint8_t i = ilo; i <= ihi; i++) gap[i][j] = GAP_NONE;   // Leave the run for the next pass
+          continue;
+        }
+
+        // Edge positions along the row, in the order they were crossed
+        float edge[PROBE_SCAN_EVENTS];
+        uint8_t edges = 0;
+        for (Endstops::scan_event_t ev; endstops.scan_event(ev);)
+          edge[edges++] = ev.x * planner.steps_to_mm[X_AXIS] + probe.offset_xy.x;
+        SERIAL_ECHOLNPAIR("TMP row ", j, " h ", h, " ilo ", ilo, " ihi ", ihi, " start ", start_state, " edges ", edges, " pa ", pa.x, " pb ", pb.x, " e0 ", edges ? edge[0] : -1, " e1 ", edges > 1 ? edge[1] : -1, " zpos ", current_position.z);
+
+        for (uint8_t i = ilo; i <= ihi; i++) {
+          const float x = mesh_pos(i, j).x;
+
+          // The probe state over the point, and the nearest contour
+          bool triggered = start_state;
+          float dist = -1;
+          LOOP_L_N(e, edges) {
+            if (reverse ? edge[e] > x : edge[e] < x) triggered = !triggered;
+            const float d = ABS(edge[e] - x);
+            if (dist < 0 || d < dist) dist = d;
+          }
+
+          if (triggered) {
+            if (first_pass)
+              gap[i][j] = GAP_SKIP;                 // Above the scan range
+            else {
+              const float d1 = gap[i][j] == GAP_NONE ? -1 : gap[i][j] * gap_unit,
+                          f = (dist >= 0 && d1 >= 0 && dist + d1 > 0) ? dist / (dist + d1) : 0.5f;
+              z[i][j] = h + (PROBE_SCAN_Z_STEP) * f;
+              found++;
+            }
+          }
+          else
+            gap[i][j] = dist < 0 ? GAP_NONE : uint8_t(_MIN(dist / gap_unit + 0.5f, float(GAP_SKIP - 1)));
+        }
+      }
+    }
+
+    if (first_pass) {
+      // Points above the range aren't wanted any more
+      wanted = 0;
+      GRID_LOOP(i, j) if (is_wanted(i, j)) wanted++;
+    }
+
+    if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPAIR("Scan pass Z", h, " found ", found, "/", wanted);
+  }
+
+  SERIAL_ECHOLNPAIR("Scan found ", found, "/", wanted, " points in ", (millis() - scan_start_ms) / 1000UL, "s");
+  return found;
+}
+
+#endif // PROBE_FLYBY_SCAN
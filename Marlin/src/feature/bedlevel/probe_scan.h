@@ -0,0 +1,44 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * probe_scan.h - Fly-by mesh scanning
+ *
+ * Move the probe across each mesh row at a fixed height while the endstop
+ * ISR latches the XY position of every probe edge. Passes step down in Z,
+ * and each mesh point takes the height of the first pass where it triggers.
+ */
+
+#include "bedlevel.h"
+
+class ProbeScan {
+public:
+  /**
+   * Scan for the invalid (NAN) points in 'z' that the probe can reach.
+   * Mesh point (i, j) is located at 'origin' + 'spacing' * (i, j).
+   * Returns the number of points found.
+   */
+  static uint16_t scan_mesh(bed_mesh_t &z, const xy_pos_t &origin, const xy_float_t &spacing);
+};
+
+extern ProbeScan probe_scan;
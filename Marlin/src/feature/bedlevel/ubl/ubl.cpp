@@ -133,6 +133,91 @@ void unified_bed_leveling::set_all_mesh_points_to_value(const_float_t value) {
     GRID_LOOP(x, y) out_values[x][y] = store_to_z(stored_values[x][y]);
   }
 
+  #if ENABLED(MESH_BANK)
+
+    // Bit stream over a byte buffer, least significant bit first
+    class MeshBits {
+      uint8_t * const buf;
+      const uint32_t size;
+      uint32_t bit;
+    public:
+      MeshBits(uint8_t * const b, const uint16_t s) : buf(b), size(uint32_t(s) << 3), bit(0) {}
+      uint16_t length() const { return (bit + 7) >> 3; }
+      bool put(const uint32_t v, const uint8_t n) {
+        if (bit + n > size) return false;
+        LOOP_L_N(i, n) {
+          const uint8_t m = _BV(bit & 7);
+          if ((v >> i) & 1) buf[bit >> 3] |= m; else buf[bit >> 3] &= ~m;
+          bit++;
+        }
+        return true;
+      }
+      bool get(uint32_t &v, const uint8_t n) {
+        if (bit + n > size) return false;
+        v = 0;
+        LOOP_L_N(i, n) { if (TEST(buf[bit >> 3], bit & 7)) SBI32(v, i); bit++; }
+        return true;
+      }
+    };
+
+    static constexpr uint8_t mesh_width_bits = 5;
+
+    static int32_t ref_or_zero(const int16_t r) { return r == Z_STEPS_NAN ? 0 : r; }
+
+    /**
+     * Pack a mesh store as differences from a reference mesh.
+     * In each row (constant X) the differences are predicted from the previous
+     * valid point. The residuals are zigzag-coded (0 means NAN) and packed with
+     * the smallest bit width that fits the row.
+     * Return the packed length, or 0 if it won't fit in 'size' bytes.
+     */
+    uint16_t unified_bed_leveling::pack_mesh_store(const mesh_store_t &stored_values, const mesh_store_t &ref_values, uint8_t * const buf, const uint16_t size) {
+      MeshBits bits(buf, size);
+      LOOP_L_N(x, GRID_MAX_POINTS_X) {
+        uint32_t code[GRID_MAX_POINTS_Y], most = 0;
+        int32_t prev = 0;
+        LOOP_L_N(y, GRID_MAX_POINTS_Y) {
+          const int16_t z = stored_values[x][y];
+          if (z == Z_STEPS_NAN)
+            code[y] = 0;
+          else {
+            const int32_t d = z - ref_or_zero(ref_values[x][y]), e = d - prev;
+            code[y] = (uint32_t(e) << 1 ^ uint32_t(e >> 31)) + 1;
+            prev = d;
+          }
+          NOLESS(most, code[y]);
+        }
+        uint8_t width = 0;
+        while (most) { width++; most >>= 1; }
+        if (!bits.put(width, mesh_width_bits)) return 0;
+        LOOP_L_N(y, GRID_MAX_POINTS_Y) if (!bits.put(code[y], width)) return 0;
+      }
+      return bits.length();
+    }
+
+    // Unpack a mesh store packed by pack_mesh_store. Return false if the data is short.
+    bool unified_bed_leveling::unpack_mesh_store(const uint8_t * const buf, const uint16_t len, const mesh_store_t &ref_values, mesh_store_t &stored_values) {
+      MeshBits bits(const_cast<uint8_t*>(buf), len);
+      LOOP_L_N(x, GRID_MAX_POINTS_X) {
+        uint32_t width, code;
+        if (!bits.get(width, mesh_width_bits)) return false;
+        int32_t prev = 0;
+        LOOP_L_N(y, GRID_MAX_POINTS_Y) {
+          if (!bits.get(code, width)) return false;
+          if (code == 0)
+            stored_values[x][y] = Z_STEPS_NAN;
+          else {
+            code--;
+            prev += int32_t(code >> 1) ^ -int32_t(code & 1);
+            stored_values[x][y] = int16_t(ref_or_zero(ref_values[x][y]) + prev);
+          }
+        }
+      }
+      return true;
+    }
+
+  #endif // MESH_BANK
+
 #endif // OPTIMIZED_MESH_STORAGE
 
 static void serial_echo_xy(const uint8_t sp, const int16_t x, const int16_t y) {
@@ -116,6 +116,10 @@ public:
   #if ENABLED(OPTIMIZED_MESH_STORAGE)
     static void set_store_from_mesh(const bed_mesh_t &in_values, mesh_store_t &stored_values);
     static void set_mesh_from_store(const mesh_store_t &stored_values, bed_mesh_t &out_values);
+    #if ENABLED(MESH_BANK)
+      static uint16_t pack_mesh_store(const mesh_store_t &stored_values, const mesh_store_t &ref_values, uint8_t * const buf, const uint16_t size);
+      static bool unpack_mesh_store(const uint8_t * const buf, const uint16_t len, const mesh_store_t &ref_values, mesh_store_t &stored_values);
+    #endif
   #endif
   static const float _mesh_index_to_xpos[GRID_MAX_POINTS_X],
                      _mesh_index_to_ypos[GRID_MAX_POINTS_Y];
@@ -53,6 +53,14 @@
   #include "../hilbert_curve.h"
 #endif
 
+#if ENABLED(PROBE_PATH_OPTIMIZER)
+  #include "../probe_path.h"
+#endif
+
+#if ENABLED(PROBE_FLYBY_SCAN)
+  #include "../probe_scan.h"
+#endif
+
 #include <math.h>
 
 #define UBL_G29_P31
@@ -154,6 +162,9 @@
  *
  *                    Use 'T' (Topology) to generate a report of mesh generation.
  *
+ *                    Use 'O' (Overfly) to scan the mesh with continuous moves first (PROBE_FLYBY_SCAN). Points
+ *                    missed by the scan are then probed normally.
+ *
  *                    P1 will suspend Mesh generation if the controller button is held down. Note that you may need
  *                    to press and hold the switch for several seconds if moves are underway.
  *
@@ -433,6 +444,14 @@ void unified_bed_leveling::G29() {
             SERIAL_DECIMAL(param.XY_pos.y);
             SERIAL_ECHOLNPGM(").\n");
           }
+          #if ENABLED(PROBE_FLYBY_SCAN)
+            if (parser.seen('O')) {
+              save_ubl_active_state_and_disable();
+              probe.deploy();
+              probe_scan.scan_mesh(z_values, { MESH_MIN_X, MESH_MIN_Y }, { MESH_X_DIST, MESH_Y_DIST });
+              restore_ubl_active_state_and_leave();
+            }
+          #endif
           probe_entire_mesh(param.XY_pos, parser.seen('T'), parser.seen('E'), parser.seen('U'));
 
           report_current_position();
@@ -606,9 +625,15 @@ void unified_bed_leveling::G29() {
       return;
     }
 
-    settings.load_mesh(param.KLS_storage_slot);
+    const bool loaded = settings.load_mesh(param.KLS_storage_slot);
     storage_slot = param.KLS_storage_slot;
 
+    #if ENABLED(MESH_BANK)
+      if (loaded) SERIAL_ECHOLNPAIR("Mesh loaded from slot ", param.KLS_storage_slot, " in ", settings.mesh_load_us, "us");
+    #else
+      UNUSED(loaded);
+    #endif
+
     SERIAL_ECHOLNPGM("Done.");
   }
 
@@ -716,6 +741,13 @@ void unified_bed_leveling::shift_mesh_height() {
 }
 
 #if HAS_BED_PROBE
+  #if ENABLED(PROBE_PATH_OPTIMIZER)
+    // Plan a path through the invalid mesh points that the probe can reach
+    static bool probe_path_filter(const uint8_t i, const uint8_t j, const xy_pos_t &pos) {
+      return isnan(ubl.z_values[i][j]) && probe.can_reach(pos);
+    }
+  #endif
+
   /**
    * G29 P1 T<maptype> V<verbosity> : Probe Entire Mesh
    *   Probe all invalidated locations of the mesh that can be reached by the probe.
@@ -729,6 +761,12 @@ void unified_bed_leveling::shift_mesh_height() {
     save_ubl_active_state_and_disable();  // No bed level correction so only raw data is obtained
     uint8_t count = GRID_MAX_POINTS;
 
+    #if ENABLED(PROBE_PATH_OPTIMIZER)
+      if (!do_furthest)
+        probe_path.plan({ GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y }, { MESH_MIN_X, MESH_MIN_Y }, { MESH_X_DIST, MESH_Y_DIST }, nearby + probe.offset_xy, probe_path_filter);
+      probe_path_index_t path_index = 0;
+    #endif
+
     mesh_index_pair best;
     TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::G29_START));
     do {
@@ -750,9 +788,21 @@ void unified_bed_leveling::shift_mesh_height() {
         }
       #endif
 
-      best = do_furthest
-        ? find_furthest_invalid_mesh_point()
-        : find_closest_mesh_point_of_type(INVALID, nearby, true);
+      #if ENABLED(PROBE_PATH_OPTIMIZER)
+        if (do_furthest)
+          best = find_furthest_invalid_mesh_point();
+        else {
+          best.invalidate();
+          if (path_index < probe_path.count) {
+            const xy_uint8_t ij = probe_path.point(path_index++);
+            best.pos.set(ij.x, ij.y);
+          }
+        }
+      #else
+        best = do_furthest
+          ? find_furthest_invalid_mesh_point()
+          : find_closest_mesh_point_of_type(INVALID, nearby, true);
+      #endif
 
       if (best.pos.x >= 0) {    // mesh point found and is reachable by probe
         TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::G29_POINT_START));
@@ -1836,9 +1886,12 @@ void unified_bed_leveling::smart_fill_mesh() {
     param.KLS_storage_slot = parser.value_int();
 
     float tmp_z_values[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
-    settings.load_mesh(param.KLS_storage_slot, &tmp_z_values);
+    if (!settings.load_mesh(param.KLS_storage_slot, &tmp_z_values)) return;
 
     SERIAL_ECHOLNPAIR("Subtracting mesh in slot ", param.KLS_storage_slot, " from current mesh.");
+    #if ENABLED(MESH_BANK)
+      SERIAL_ECHOLNPAIR("Slot loaded in ", settings.mesh_load_us, "us");
+    #endif
 
     GRID_LOOP(x, y) {
       z_values[x][y] -= tmp_z_values[x][y];
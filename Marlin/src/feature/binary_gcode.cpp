@@ -0,0 +1,133 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * binary_gcode.cpp - Binary G-code frames
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(BINARY_GCODE)
+
+#include "binary_gcode.h"
+
+BinaryGcode binaryGcode[NUM_SERIAL];
+
+/**
+ * Commands that can be sent as frames. Parameters are in letter order
+ * so the values go into the parsed command in the order the parser expects.
+ */
+typedef struct {
+  char letter;
+  uint8_t codenum;
+  char params[PARSED_GCODE_PARAMS + 1];
+} binary_gcode_op_t;
+
+static const binary_gcode_op_t binary_gcode_ops[] PROGMEM = {
+  { 'G',   0, "EFXYZ"     },
+  { 'G',   1, "EFXYZ"     },
+  { 'G',   2, "EFIJPRXYZ" },
+  { 'G',   3, "EFIJPRXYZ" },
+  { 'M', 104, "ST"        },
+  { 'M', 106, "PS"        }
+};
+
+BinaryGcode::Result BinaryGcode::receive(const uint8_t c, const bool line_start) {
+
+  // Inside a frame collect the bytes. Get the frame size from the header.
+  if (frame_len) {
+    buf[count++] = c;
+    if (count == kHeaderSize) {
+      if (buf[0] >= COUNT(binary_gcode_ops)) { frame_len = 0; return BG_ERROR; }
+      const uint16_t mask = buf[1] | (buf[2] << 8);
+      const uint8_t nparams = strlen_P(binary_gcode_ops[buf[0]].params);
+      uint8_t nvalues = 0;
+      LOOP_L_N(i, 16) if (TEST(mask, i)) {
+        if (i >= nparams) { frame_len = 0; return BG_ERROR; }
+        nvalues++;
+      }
+      frame_len = kHeaderSize + nvalues * 4 + 1;
+    }
+    if (count < frame_len) return BG_CONSUMED;
+
+    // Verify the frame
+    frame_len = 0;
+    uint8_t check = 0;
+    LOOP_L_N(i, count - 1) check ^= buf[i];
+    return check == buf[count - 1] ? BG_FRAME : BG_ERROR;
+  }
+
+  if (!line_start) return BG_TEXT;
+
+  // Two command bytes and a command, as with MeatPack
+  if (sync_count == 2) {
+    sync_count = 0;
+    switch (c) {
+      case BGCommand_Enable:  enabled = true;  break;
+      case BGCommand_Disable: enabled = false; break;
+      case BGCommand_Query: break;
+      default: return BG_CONSUMED;
+    }
+    report_state();
+    return BG_CONSUMED;
+  }
+  if (c == kCommandByte) { sync_count++; return BG_CONSUMED; }
+  sync_count = 0;
+
+  if (enabled && c == kFrameStart) {
+    frame_len = kHeaderSize;
+    count = 0;
+    return BG_CONSUMED;
+  }
+
+  return BG_TEXT;
+}
+
+void BinaryGcode::decode(parsed_gcode_t &out) const {
+  binary_gcode_op_t op;
+  memcpy_P(&op, &binary_gcode_ops[buf[0]], sizeof(op));
+
+  out.nul = '\0';
+  out.letter = op.letter;
+  out.codenum = op.codenum;
+  out.codebits = 0;
+
+  const uint16_t mask = buf[1] | (buf[2] << 8);
+  const uint8_t *v = &buf[kHeaderSize];
+  uint8_t n = 0;
+  for (uint8_t i = 0; op.params[i]; i++) {
+    if (!TEST(mask, i)) continue;
+    const int32_t fixed = int32_t(uint32_t(v[0]) | (uint32_t(v[1]) << 8) | (uint32_t(v[2]) << 16) | (uint32_t(v[3]) << 24));
+    SBI32(out.codebits, LETTER_BIT(op.params[i]));
+    out.value[n++] = fixed * 0.001f;
+    v += 4;
+  }
+}
+
+void BinaryGcode::report_state() {
+  PORT_REDIRECT(SERIAL_PORTMASK(uint8_t(this - binaryGcode)));
+  SERIAL_ECHOPGM("[BG] ");
+  serialprint_onoff(enabled);
+  SERIAL_EOL();
+}
+
+#endif // BINARY_GCODE
@@ -0,0 +1,91 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * binary_gcode.h - Binary G-code frames
+ *
+ * Hosts can send the most frequent commands as compact binary frames that go
+ * into the command queue already parsed. Binary mode is enabled per serial port
+ * with the same sequence MeatPack uses for its commands:
+ *
+ *   0xFF 0xFF 0xF5 : Enable binary frames
+ *   0xFF 0xFF 0xF4 : Disable binary frames
+ *   0xFF 0xFF 0xF3 : Report the current state
+ *
+ * With binary mode enabled a line starting with 0xFE is a frame:
+ *
+ *   0xFE <op> <mask lo> <mask hi> <value>... <check>
+ *
+ *   op    : Command index in the table below
+ *   mask  : Bit n is set if the n-th parameter of the command is included
+ *   value : int32, little-endian, in thousandths (e.g., mm * 1000)
+ *   check : XOR of all bytes after 0xFE
+ *
+ * Frames count as lines for line numbering, so a bad frame gets the usual
+ * "Resend:" reply. Text commands can still be sent between frames.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../gcode/parser.h"
+
+enum BinaryGcode_Command : uint8_t {
+  BGCommand_Query   = 0xF3,
+  BGCommand_Disable = 0xF4,
+  BGCommand_Enable  = 0xF5
+};
+
+class BinaryGcode {
+  static constexpr uint8_t kCommandByte = 0xFF,
+                           kFrameStart  = 0xFE,
+                           kHeaderSize  = 3,      // op, mask lo, mask hi
+                           kFrameMax    = kHeaderSize + (PARSED_GCODE_PARAMS) * 4 + 1;
+
+  bool enabled;
+  uint8_t sync_count,           // Command bytes received at the start of a line
+          frame_len,            // Expected frame length, or 0 if not in a frame
+          count;                // Frame bytes received so far
+  uint8_t buf[kFrameMax];
+
+public:
+  enum Result : uint8_t {
+    BG_TEXT,                    // Not binary, so handle as text
+    BG_CONSUMED,                // Used by the binary protocol
+    BG_FRAME,                   // A complete frame is ready to decode
+    BG_ERROR                    // A bad frame was received
+  };
+
+  /**
+   * Pass in a character received on this port.
+   * 'line_start' is true when there's no partial line of text.
+   */
+  Result receive(const uint8_t c, const bool line_start);
+
+  // Decode the frame just received. Call after receive() returns BG_FRAME.
+  void decode(parsed_gcode_t &out) const;
+
+  void report_state();
+
+  BinaryGcode() : enabled(false), sync_count(0), frame_len(0), count(0) {}
+};
+
+extern BinaryGcode binaryGcode[NUM_SERIAL];
@@ -37,13 +37,22 @@ inline int bs_read_serial(const serial_index_t index) {
   return SERIAL_IMPL.read(index);
 }
 
+#if BINARY_FILE_TRANSFER_BLOCKS
+  // Stage uploads and write several blocks to the card in one sequence
+  #define TRANSFER_BUFFER_SIZE (BINARY_FILE_TRANSFER_BLOCKS * 512)
+#else
+  #define TRANSFER_BUFFER_SIZE 512
+#endif
+
 #if ENABLED(BINARY_STREAM_COMPRESSION)
   static heatshrink_decoder hsd;
+#endif
+#if ENABLED(BINARY_STREAM_COMPRESSION) || BINARY_FILE_TRANSFER_BLOCKS
   #if BOTH(ARDUINO_ARCH_STM32F1, SDIO_SUPPORT)
     // STM32 requires a word-aligned buffer for SD card transfers via DMA
-    static __attribute__((aligned(sizeof(size_t)))) uint8_t decode_buffer[512] = {};
+    static __attribute__((aligned(sizeof(size_t)))) uint8_t decode_buffer[TRANSFER_BUFFER_SIZE] = {};
   #else
-    static uint8_t decode_buffer[512] = {};
+    static uint8_t decode_buffer[TRANSFER_BUFFER_SIZE] = {};
   #endif
 #endif
 
@@ -51,27 +60,41 @@ class SDFileTransferProtocol  {
 private:
   struct Packet {
     struct [[gnu::packed]] Open {
+      // The filename may be followed by the 32-bit file size, if known
+      static size_t name_end(char *buffer, size_t length) {
+        return sizeof(Open) + strnlen(&buffer[sizeof(Open)], length - sizeof(Open)) + 1;
+      }
       static bool validate(char *buffer, size_t length) {
-        return (length > sizeof(Open) && buffer[length - 1] == '\0');
+        if (length <= sizeof(Open)) return false;
+        const size_t end = name_end(buffer, length);
+        return end == length || end + sizeof(uint32_t) == length;
       }
-      static Open& decode(char *buffer) {
+      static Open& decode(char *buffer, size_t length) {
         data = &buffer[2];
+        const size_t end = name_end(buffer, length);
+        size = 0;
+        if (end + sizeof(uint32_t) == length) memcpy(&size, &buffer[end], sizeof(uint32_t));
         return *reinterpret_cast<Open*>(buffer);
       }
       bool compression_enabled() { return compression & 0x1; }
       bool dummy_transfer() { return dummy & 0x1; }
       static char* filename() { return data; }
+      static uint32_t file_size() { return size; }
       private:
         uint8_t dummy, compression;
         static char* data;  // variable length strings complicate things
+        static uint32_t size;
     };
   };
 
-  static bool file_open(char *filename) {
+  static bool file_open(char *filename, const uint32_t size) {
     if (!dummy_transfer) {
       card.mount();
       card.openFileWrite(filename);
       if (!card.isFileOpen()) return false;
+      // Reserve the whole file up front. If there's no free run
+      // large enough the file just grows cluster by cluster.
+      if (size) card.preallocate(size);
     }
     transfer_active = true;
     data_waiting = 0;
@@ -103,18 +126,36 @@ private:
         return true;
       }
     #endif
-    return (dummy_transfer || card.write(buffer, length) >= 0);
+    #if BINARY_FILE_TRANSFER_BLOCKS
+      // The packet was acked on arrival, so while the buffer fills each
+      // packet is only a copy. A full buffer goes out in one sequence.
+      for (size_t total_processed = 0; total_processed < length;) {
+        const size_t count = _MIN(length - total_processed, sizeof(decode_buffer) - data_waiting);
+        memcpy(&decode_buffer[data_waiting], &buffer[total_processed], count);
+        total_processed += count;
+        data_waiting += count;
+        if (data_waiting == sizeof(decode_buffer)) {
+          if (!dummy_transfer && card.write(decode_buffer, data_waiting) < 0) return false;
+          data_waiting = 0;
+        }
+      }
+      return true;
+    #else
+      return (dummy_transfer || card.write(buffer, length) >= 0);
+    #endif
   }
 
   static bool file_close() {
     if (!dummy_transfer) {
-      #if ENABLED(BINARY_STREAM_COMPRESSION)
+      #if ENABLED(BINARY_STREAM_COMPRESSION) || BINARY_FILE_TRANSFER_BLOCKS
         // flush any buffered data
         if (data_waiting) {
           if (card.write(decode_buffer, data_waiting) < 0) return false;
           data_waiting = 0;
         }
       #endif
+      // free any clusters reserved past the end
+      if (!card.trimFile()) return false;
       card.closefile();
       card.release();
     }
@@ -166,10 +207,10 @@ public:
           SERIAL_ECHOLNPGM("PFT:busy");
         else {
           if (Packet::Open::validate(buffer, length)) {
-            auto packet = Packet::Open::decode(buffer);
+            auto packet = Packet::Open::decode(buffer, length);
             compression = packet.compression_enabled();
             dummy_transfer = packet.dummy_transfer();
-            if (file_open(packet.filename())) {
+            if (file_open(packet.filename(), packet.file_size())) {
               SERIAL_ECHOLNPGM("PFT:success");
               break;
             }
@@ -202,7 +243,7 @@ public:
     }
   }
 
-  static const uint16_t VERSION_MAJOR = 0, VERSION_MINOR = 1, VERSION_PATCH = 0, TIMEOUT = 10000, IDLE_PERIOD = 1000;
+  static const uint16_t VERSION_MAJOR = 0, VERSION_MINOR = 2, VERSION_PATCH = 0, TIMEOUT = 10000, IDLE_PERIOD = 1000;
 };
 
 class BinaryStream {
@@ -66,6 +66,8 @@ void MeatPack::reset_state() {
   cmd_is_next = false;
   second_char = 0;
   cmd_count = full_char_count = char_out_count = 0;
+  bytes_in = chars_out = 0;
+  TERN_(MEATPACK_HEATSHRINK, heatshrink_decoder_reset(&hsd));
   TERN_(MP_DEBUG, chars_decoded = 0);
 }
 
@@ -130,12 +132,49 @@ void MeatPack::handle_rx_char_inner(const uint8_t c) {
     handle_output_char(c);
 }
 
+/**
+ * Interpret a byte of the stream, decompressing it first in heatshrink mode
+ */
+void MeatPack::handle_stream_byte(const uint8_t c) {
+  ++bytes_in;
+  #if ENABLED(MEATPACK_HEATSHRINK)
+    if (TEST(state, MPConfig_Bit_Heatshrink)) {
+      uint8_t in = c;
+      size_t sunk;
+      heatshrink_decoder_sink(&hsd, &in, 1, &sunk);         // The decoder is drained before each new byte, so there's room
+      if (!char_out_count) poll_decoder();                  // The rest is taken as the output is read
+      return;
+    }
+  #endif
+  handle_rx_char_inner(c);
+}
+
+#if ENABLED(MEATPACK_HEATSHRINK)
+
+  /**
+   * Pass one decompressed byte on for unpacking. A byte of
+   * the stream may expand to several, so take them one at a
+   * time as the output is read.
+   */
+  bool MeatPack::poll_decoder() {
+    if (!TEST(state, MPConfig_Bit_Heatshrink)) return false;
+    uint8_t c;
+    size_t count;
+    heatshrink_decoder_poll(&hsd, &c, 1, &count);
+    if (!count) return false;
+    handle_rx_char_inner(c);
+    return true;
+  }
+
+#endif
+
 /**
  * Buffer a single output character which will be picked up in
  * GCodeQueue::get_serial_commands via calls to get_result_char
  */
 void MeatPack::handle_output_char(const uint8_t c) {
   char_out_buf[char_out_count++] = c;
+  ++chars_out;
 
   #if ENABLED(MP_DEBUG)
     if (chars_decoded < 1024) {
@@ -161,6 +200,14 @@ void MeatPack::handle_command(const MeatPack_Command c) {
     case MPCommand_DisableNoSpaces:
       CBI(state, MPConfig_Bit_NoSpaces);
       meatPackLookupTable[kSpaceCharIdx] = ' ';                        DEBUG_ECHOLNPGM("[MPDBG] DIS NSP");   break;
+    #if ENABLED(MEATPACK_HEATSHRINK)
+      case MPCommand_EnableHeatshrink:                                 // Start a new compressed stream
+        SBI(state, MPConfig_Bit_Heatshrink);
+        heatshrink_decoder_reset(&hsd);                                DEBUG_ECHOLNPGM("[MPDBG] ENA HS");    break;
+      case MPCommand_DisableHeatshrink:
+        CBI(state, MPConfig_Bit_Heatshrink);
+        heatshrink_decoder_reset(&hsd);                                DEBUG_ECHOLNPGM("[MPDBG] DIS HS");    break;
+    #endif
     default:                                                           DEBUG_ECHOLNPGM("[MPDBG] UNK CMD REC");
   }
   report_state();
@@ -172,7 +219,14 @@ void MeatPack::report_state() {
   SERIAL_ECHOPGM("[MP] ");
   SERIAL_ECHOPGM(MeatPack_ProtocolVersion " ");
   serialprint_onoff(TEST(state, MPConfig_Bit_Active));
-  SERIAL_ECHOPGM_P(TEST(state, MPConfig_Bit_NoSpaces) ? PSTR(" NSP\n") : PSTR(" ESP\n"));
+  SERIAL_ECHOPGM_P(TEST(state, MPConfig_Bit_NoSpaces) ? PSTR(" NSP") : PSTR(" ESP"));
+  #if ENABLED(MEATPACK_HEATSHRINK)
+    // Heatshrink state, window and lookahead bits
+    SERIAL_ECHOPAIR(" HS", TEST(state, MPConfig_Bit_Heatshrink), ",", HEATSHRINK_STATIC_WINDOW_BITS, ",", HEATSHRINK_STATIC_LOOKAHEAD_BITS);
+  #endif
+  // Characters out per byte in since the last reset
+  if (bytes_in) SERIAL_ECHOPAIR_F(" R", float(chars_out) / float(bytes_in));
+  SERIAL_EOL();
 }
 
 /**
@@ -198,11 +252,17 @@ void MeatPack::handle_rx_char(const uint8_t c, const serial_index_t serial_ind)
   }
 
   if (cmd_count) {                        // Only a single 0xFF was received
-    handle_rx_char_inner(kCommandByte);   // A single 0xFF is passed on literally so it can be interpreted as kFirstNotPacked|kSecondNotPacked
     cmd_count = 0;
+    #if ENABLED(MEATPACK_HEATSHRINK)
+      if (c == kEscapeByte && TEST(state, MPConfig_Bit_Heatshrink)) {
+        handle_stream_byte(kCommandByte); // An escaped 0xFF in the compressed stream
+        return;
+      }
+    #endif
+    handle_stream_byte(kCommandByte);     // A single 0xFF is passed on literally so it can be interpreted as kFirstNotPacked|kSecondNotPacked
   }
 
-  handle_rx_char_inner(c);                // Other characters are passed on for MeatPack decoding
+  handle_stream_byte(c);                  // Other characters are passed on for MeatPack decoding
 }
 
 uint8_t MeatPack::get_result_char(char * const __restrict out) {
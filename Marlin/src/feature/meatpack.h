@@ -51,6 +51,10 @@
 #include <stdint.h>
 #include "../core/serial_hook.h"
 
+#if ENABLED(MEATPACK_HEATSHRINK)
+  #include "../libs/heatshrink/heatshrink_decoder.h"
+#endif
+
 /**
  * Commands sent to MeatPack to control its behavior.
  * They are sent by first sending 2x MeatPack_CommandByte (0xFF) in sequence,
@@ -70,14 +74,32 @@ enum MeatPack_Command : uint8_t {
   MPCommand_ResetAll        = 0xF9,
   MPCommand_QueryConfig     = 0xF8,
   MPCommand_EnableNoSpaces  = 0xF7,
-  MPCommand_DisableNoSpaces = 0xF6
+  MPCommand_DisableNoSpaces = 0xF6,
+  MPCommand_EnableHeatshrink  = 0xF5,
+  MPCommand_DisableHeatshrink = 0xF4
 };
 
 enum MeatPack_ConfigStateBits : uint8_t {
-  MPConfig_Bit_Active   = 0,
-  MPConfig_Bit_NoSpaces = 1
+  MPConfig_Bit_Active     = 0,
+  MPConfig_Bit_NoSpaces   = 1,
+  MPConfig_Bit_Heatshrink = 2
 };
 
+/**
+ * Heatshrink mode (MEATPACK_HEATSHRINK)
+ *
+ * After MPCommand_EnableHeatshrink the stream is heatshrink (LZSS) compressed
+ * with the window and lookahead sizes given in the state report. It's decoded
+ * before packed characters are unpacked, so both modes can be used together.
+ *
+ * Since two 0xFF bytes in a row start a command, each 0xFF in the compressed
+ * stream is sent as 0xFF 0xFE.
+ *
+ * The compressor holds back its last few bytes until it's finished, so the
+ * host should finish the stream before waiting for a reply. Each
+ * MPCommand_EnableHeatshrink starts a new stream.
+ */
+
 class MeatPack {
 
   // Utility definitions
@@ -87,6 +109,8 @@ class MeatPack {
                        kFirstCharIsLiteral  = 0b00000001,
                        kSecondCharIsLiteral = 0b00000010;
 
+  static const uint8_t kEscapeByte          = 0b11111110;   // 0xFF 0xFE is a literal 0xFF in heatshrink mode
+
   static const uint8_t kSpaceCharIdx = 11;
   static const char kSpaceCharReplace = 'E';
 
@@ -97,6 +121,12 @@ class MeatPack {
           full_char_count, // Counter for full-width characters to be received
           char_out_count;  // Stores number of characters to be read out.
   uint8_t char_out_buf[2]; // Output buffer for caching up to 2 characters
+  uint32_t bytes_in,       // Stream bytes received, for the compression ratio
+           chars_out;      // Characters sent on
+
+  #if ENABLED(MEATPACK_HEATSHRINK)
+    heatshrink_decoder hsd;
+  #endif
 
 public:
   // Pass in a character rx'd by SD card or serial. Automatically parses command/ctrl sequences,
@@ -117,8 +147,14 @@ public:
   void handle_command(const MeatPack_Command c);
   void handle_output_char(const uint8_t c);
   void handle_rx_char_inner(const uint8_t c);
+  void handle_stream_byte(const uint8_t c);
 
-  MeatPack() : cmd_is_next(false), state(0), second_char(0), cmd_count(0), full_char_count(0), char_out_count(0) {}
+  #if ENABLED(MEATPACK_HEATSHRINK)
+    // Unpack the next decompressed byte, if any. Call only when the output has been taken.
+    bool poll_decoder();
+  #endif
+
+  MeatPack() : cmd_is_next(false), state(0), second_char(0), cmd_count(0), full_char_count(0), char_out_count(0), bytes_in(0), chars_out(0) {}
 };
 
 // Implement the MeatPack serial class so it's transparent to rest of the code
@@ -134,6 +170,11 @@ struct MeatpackSerial : public SerialBase <MeatpackSerial < SerialT >> {
   uint8_t readIndex;
 
   NO_INLINE void write(uint8_t c)     { out.write(c); }
+  void write(const uint8_t *buffer, size_t size) { out.write(buffer, size); }
+  #if SERIAL_OUTPUT_BUFFER
+    void flushOutput(const bool held=true)           { CALL_IF_EXISTS(void, &out, flushOutput, held); }
+    void holdOutput(serial_index_t index, const bool hold) { CALL_IF_EXISTS(void, &out, holdOutput, index, hold); }
+  #endif
   void flush()                        { out.flush();  }
   void begin(long br)                 { out.begin(br); readIndex = 0; }
   void end()                          { out.end(); }
@@ -146,16 +187,18 @@ struct MeatpackSerial : public SerialBase <MeatpackSerial < SerialT >> {
 
 
   int available(serial_index_t index) {
-    if (charCount) return charCount;          // The buffer still has data
-    if (out.available(index) <= 0) return 0;  // No data to read
-
-    // Don't read in read method, instead do it here, so we can make progress in the read method
-    const int r = out.read(index);
-    if (r == -1) return 0;  // This is an error from the underlying serial code
-    meatpack.handle_rx_char((uint8_t)r, index);
-    charCount = meatpack.get_result_char(serialBuffer);
-    readIndex = 0;
-
+    while (!charCount) {                          // Until the buffer has data
+      if (!TERN0(MEATPACK_HEATSHRINK, meatpack.poll_decoder())) { // Decompressed bytes are still waiting?
+        if (out.available(index) <= 0) return 0;  // No data to read
+
+        // Don't read in read method, instead do it here, so we can make progress in the read method
+        const int r = out.read(index);
+        if (r == -1) return 0;  // This is an error from the underlying serial code
+        meatpack.handle_rx_char((uint8_t)r, index);
+      }
+      charCount = meatpack.get_result_char(serialBuffer);
+      readIndex = 0;
+    }
     return charCount;
   }
 
@@ -40,6 +40,36 @@ uint8_t PrintJobRecovery::queue_index_r;
 uint32_t PrintJobRecovery::cmd_sdpos, // = 0
          PrintJobRecovery::sdpos[BUFSIZE];
 
+#if POWER_LOSS_RECOVERY_SLOTS
+
+  #include "../libs/crc16.h"
+
+  bool PrintJobRecovery::pending; // = false
+  uint32_t PrintJobRecovery::seq; // = 0
+
+  // One record of the ring, padded to a whole block so it goes out in a single write
+  typedef union {
+    uint8_t block[512];
+    struct {
+      uint32_t seq;               // Non-zero sequence number. The highest one is the newest.
+      uint16_t crc;               // CRC16 of the sequence number and the info
+      job_recovery_info_t info;
+    } rec;
+  } plr_slot_t;
+
+  static_assert(sizeof(plr_slot_t) == 512, "job_recovery_info_t is too large for POWER_LOSS_RECOVERY_SLOTS.");
+
+  static plr_slot_t slot;
+
+  static uint16_t slot_crc() {
+    uint16_t crc = 0;
+    crc16(&crc, &slot.rec.seq, sizeof(slot.rec.seq));
+    crc16(&crc, &slot.rec.info, sizeof(slot.rec.info));
+    return crc;
+  }
+
+#endif
+
 #include "../sd/cardreader.h"
 #include "../lcd/marlinui.h"
 #include "../gcode/queue.h"
@@ -116,6 +146,10 @@ void PrintJobRecovery::check() {
  * Delete the recovery file and clear the recovery data
  */
 void PrintJobRecovery::purge() {
+  #if POWER_LOSS_RECOVERY_SLOTS
+    pending = false;
+    close();
+  #endif
   init();
   card.removeJobRecoveryFile();
 }
@@ -124,9 +158,16 @@ void PrintJobRecovery::purge() {
  * Load the recovery data, if it exists
  */
 void PrintJobRecovery::load() {
+  #if POWER_LOSS_RECOVERY_SLOTS
+    close(); // The ring stays open for writing during a print
+  #endif
   if (exists()) {
     open(true);
-    (void)file.read(&info, sizeof(info));
+    #if POWER_LOSS_RECOVERY_SLOTS
+      seq = read_slots(true);
+    #else
+      (void)file.read(&info, sizeof(info));
+    #endif
     close();
   }
   debug(PSTR("Load"));
@@ -230,7 +271,11 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=0*/
     info.flag.dryrun = !!(marlin_debug_flags & MARLIN_DEBUG_DRYRUN);
     info.flag.allow_cold_extrusion = TERN0(PREVENT_COLD_EXTRUSION, thermalManager.allow_cold_extrude);
 
-    write();
+    #if POWER_LOSS_RECOVERY_SLOTS
+      pending = true;   // Written by task() at the next idle()
+    #else
+      write();
+    #endif
   }
 }
 
@@ -289,7 +334,12 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=0*/
     #endif
 
     // Save, including the limited Z raise
-    if (IS_SD_PRINTING()) save(true, zraise);
+    if (IS_SD_PRINTING()) {
+      save(true, zraise);
+      #if POWER_LOSS_RECOVERY_SLOTS
+        flush();        // There may be no more idle() calls
+      #endif
+    }
 
     // Disable all heaters to reduce power loss
     thermalManager.disable_all_heaters();
@@ -313,13 +363,82 @@ void PrintJobRecovery::write() {
 
   debug(PSTR("Write"));
 
-  open(false);
-  file.seekSet(0);
-  const int16_t ret = file.write(&info, sizeof(info));
-  if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
-  if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+  #if POWER_LOSS_RECOVERY_SLOTS
+
+    // Overwrite the oldest record of the ring with one block write.
+    // The file keeps its size, so no FAT or directory update is needed.
+    if (!file.isOpen() && !open_slots()) return;
+
+    if (!++seq) ++seq; // non-zero in sequence
+    slot.rec.seq = seq;
+    memcpy(&slot.rec.info, &info, sizeof(info));
+    slot.rec.crc = slot_crc();
+
+    if (!file.seekSet(uint32_t(seq % (POWER_LOSS_RECOVERY_SLOTS)) << 9) || file.write(slot.block, sizeof(slot)) != int16_t(sizeof(slot)))
+      DEBUG_ECHOLNPGM("Power-loss file write failed.");
+
+  #else
+
+    open(false);
+    file.seekSet(0);
+    const int16_t ret = file.write(&info, sizeof(info));
+    if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+    if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+
+  #endif
 }
 
+#if POWER_LOSS_RECOVERY_SLOTS
+
+  /**
+   * Open the recovery file for writing records, leaving it open.
+   * A file of the wrong size is replaced by a ring of empty records.
+   * Otherwise the sequence continues from the newest record it holds.
+   */
+  bool PrintJobRecovery::open_slots() {
+    constexpr uint32_t ring_size = uint32_t(POWER_LOSS_RECOVERY_SLOTS) << 9;
+
+    open(false);
+    if (!file.isOpen()) return false;
+
+    if (file.fileSize() == ring_size) {
+      NOLESS(seq, read_slots(false));
+      return true;
+    }
+
+    bool ok = file.truncate(0);
+    if (ok) {
+      (void)file.preAllocate(ring_size); // Contiguous if possible
+      ZERO(slot.block);
+      for (uint8_t i = 0; ok && i < (POWER_LOSS_RECOVERY_SLOTS); ++i)
+        ok = file.write(slot.block, sizeof(slot)) == int16_t(sizeof(slot));
+      ok = ok && file.sync();
+    }
+    if (!ok) {
+      DEBUG_ECHOLNPGM("Power-loss file create failed.");
+      close();
+    }
+    return ok;
+  }
+
+  /**
+   * Scan the ring for the newest intact record and return its sequence number.
+   * With 'restore' copy the record to info, or clear info if there is none.
+   */
+  uint32_t PrintJobRecovery::read_slots(const bool restore) {
+    uint32_t newest = 0;
+    if (restore) init();
+    for (uint8_t i = 0; i < (POWER_LOSS_RECOVERY_SLOTS); ++i) {
+      if (!file.seekSet(uint32_t(i) << 9) || file.read(slot.block, sizeof(slot)) != int16_t(sizeof(slot))) break;
+      if (slot.rec.seq <= newest || slot.rec.crc != slot_crc() || !slot.rec.info.valid()) continue;
+      newest = slot.rec.seq;
+      if (restore) memcpy(&info, &slot.rec.info, sizeof(info));
+    }
+    return newest;
+  }
+
+#endif
+
 /**
  * Resume the saved print job
  */
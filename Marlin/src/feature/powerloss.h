@@ -175,6 +175,13 @@ class PrintJobRecovery {
     static void load();
     static void save(const bool force=ENABLED(SAVE_EACH_CMD_MODE), const float zraise=0);
 
+    #if POWER_LOSS_RECOVERY_SLOTS
+      static bool pending;            //!< Saved info waiting to be written by task()
+      static uint32_t seq;            //!< Sequence number of the newest record
+      static inline void task() { if (pending) flush(); }
+      static inline void flush() { pending = false; write(); }
+    #endif
+
     #if PIN_EXISTS(POWER_LOSS)
       static inline void outage() {
         if (enabled && READ(POWER_LOSS_PIN) == POWER_LOSS_STATE)
@@ -196,6 +203,11 @@ class PrintJobRecovery {
   private:
     static void write();
 
+    #if POWER_LOSS_RECOVERY_SLOTS
+      static bool open_slots();
+      static uint32_t read_slots(const bool restore);
+    #endif
+
     #if ENABLED(BACKUP_POWER_SUPPLY)
       static void retract_and_lift(const_float_t zraise);
     #endif
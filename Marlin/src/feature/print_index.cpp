@@ -0,0 +1,364 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/print_index.cpp - Layer index for SD print files
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#if ENABLED(SD_PRINT_INDEX)
+
+#include "print_index.h"
+#include "../sd/cardreader.h"
+#include "../gcode/gcode.h"
+#include "../gcode/queue.h"
+#include "../module/motion.h"
+
+#ifndef PRINT_INDEX_ZRAISE
+  #define PRINT_INDEX_ZRAISE 2    // Clearance for travel to the start of a layer
+#endif
+
+PrintIndex print_index;
+
+PrintIndex::State PrintIndex::state; // = IDLE
+SdFile PrintIndex::index_file, PrintIndex::scan_file;
+print_index_header_t PrintIndex::header;
+
+uint32_t PrintIndex::cur_layer;
+print_index_record_t PrintIndex::cur, PrintIndex::next;
+
+char PrintIndex::line[MAX_CMD_SIZE];
+uint8_t PrintIndex::line_len;
+bool PrintIndex::line_comment;
+uint32_t PrintIndex::scan_pos, PrintIndex::line_pos;
+print_index_record_t PrintIndex::modal;
+print_index_record_t PrintIndex::batch[8];
+uint8_t PrintIndex::batch_count;
+
+// JOB.GCO => JOB.IDX
+static void index_name(char * const dst, const char * const fname) {
+  strcpy(dst, fname);
+  char * const dot = strrchr(dst, '.');
+  strcpy_P(dot ?: dst + strlen(dst), PSTR(".IDX"));
+}
+
+/**
+ * Load the index for a file just opened for print,
+ * or start building one if it's missing or out of date.
+ */
+void PrintIndex::open(SdFile &dir, SdFile &file, const char * const fname) {
+  close();
+
+  dir_t d;
+  if (!file.dirEntry(&d)) return;
+  header.file_size = file.fileSize();
+  header.date = d.lastWriteDate;
+  header.time = d.lastWriteTime;
+
+  char name[FILENAME_LENGTH];
+  index_name(name, fname);
+
+  if (index_file.open(&dir, name, O_READ)) {
+    print_index_header_t h;
+    if (index_file.read(&h, sizeof(h)) == sizeof(h)
+      && h.magic == PRINT_INDEX_MAGIC && h.version == PRINT_INDEX_VERSION
+      && h.record_size == sizeof(print_index_record_t)
+      && h.file_size == header.file_size && h.date == header.date && h.time == header.time
+    ) {
+      // A file with no layers keeps its (empty) index so it isn't scanned again
+      header = h;
+      if (header.layers && set_layer(0))
+        state = LOADED;
+      else
+        index_file.close();
+      return;
+    }
+    index_file.close();
+  }
+
+  #if DISABLED(SDCARD_READONLY)
+    if (!index_file.open(&dir, name, O_CREAT | O_RDWR | O_TRUNC)) return;
+
+    // Incomplete until finish_build() writes the magic number
+    header.magic = 0;
+    header.version = PRINT_INDEX_VERSION;
+    header.record_size = sizeof(print_index_record_t);
+    header.layers = 0;
+    header.e_total = 0;
+    if (index_file.write(&header, sizeof(header)) != sizeof(header)) { index_file.close(); return; }
+
+    // Read the file with a copy of its handle
+    scan_file = file;
+    scan_file.rewind();
+    scan_pos = line_pos = 0;
+    line_len = batch_count = 0;
+    line_comment = false;
+    modal = {};
+    state = BUILDING;
+  #endif
+}
+
+void PrintIndex::close() {
+  if (state == BUILDING) scan_file.close();
+  if (index_file.isOpen()) index_file.close();
+  state = IDLE;
+}
+
+// Remove the index when its file is rewritten or deleted
+void PrintIndex::remove(SdFile &dir, const char * const fname) {
+  char name[FILENAME_LENGTH];
+  index_name(name, fname);
+  SdFile::remove(&dir, name);
+}
+
+bool PrintIndex::read_record(const uint32_t n, print_index_record_t &rec) {
+  return index_file.seekSet(sizeof(print_index_header_t) + n * sizeof(print_index_record_t))
+      && index_file.read(&rec, sizeof(rec)) == sizeof(rec);
+}
+
+bool PrintIndex::set_layer(const uint32_t n) {
+  cur_layer = n;
+  return read_record(n, cur) && (n + 1 >= header.layers || read_record(n + 1, next));
+}
+
+/**
+ * Called from idle() to scan one block of a file being indexed,
+ * or to follow the print position from layer to layer.
+ */
+void PrintIndex::task() {
+  if (state == IDLE) return;
+
+  // Stop when the print file is closed
+  if (!card.isFileOpen()) return close();
+
+  if (state == BUILDING) {
+    const uint8_t *ptr;
+    const int16_t n = scan_file.readCached(ptr);
+    if (n < 0) return close();
+    if (n == 0) return finish_build();
+
+    // Records are written between blocks, since that reuses the block cache
+    if (scan((const char*)ptr, n) < n) scan_file.seekSet(scan_pos);
+    if (batch_count == COUNT(batch) && !flush_batch()) close();
+  }
+  else {
+    // One layer per call. Start over after a seek backward.
+    const uint32_t pos = card.getIndex();
+    bool ok = true;
+    if (cur_layer && pos < cur.pos)
+      ok = set_layer(0);
+    else if (cur_layer + 1 < header.layers && pos >= next.pos)
+      ok = set_layer(cur_layer + 1);
+    if (!ok) close();
+  }
+}
+
+// Scan bytes until the record batch fills. Return the number used.
+uint16_t PrintIndex::scan(const char *buf, const uint16_t len) {
+  uint16_t i = 0;
+  while (i < len) {
+    const char c = buf[i++];
+    scan_pos++;
+    if (c == '\n' || c == '\r') {
+      if (line_len) {
+        line[line_len] = '\0';
+        parse_line();
+        line_len = 0;
+      }
+      line_comment = false;
+      line_pos = scan_pos;
+      if (batch_count == COUNT(batch)) break;
+    }
+    else if (!line_comment && line_len < sizeof(line) - 1) {
+      // Keep a whole-line comment, which may be a layer marker, but drop trailing comments
+      if (c == ';' && line_len) line_comment = true;
+      else if (c != ' ' || line_len) line[line_len++] = c;
+    }
+  }
+  return i;
+}
+
+static bool seen(const char * const p, const char letter, float &value) {
+  const char * const s = strchr(p, letter);
+  if (s) value = strtod(s + 1, nullptr);
+  return s;
+}
+
+// Track the modal state through one line, and add a record at each layer change
+void PrintIndex::parse_line() {
+  char *p = line;
+  while (*p == ' ') p++;
+
+  if (*p == ';') {
+    // Layer change comments from Cura, PrusaSlicer and Simplify3D
+    p++;
+    if (!strncmp_P(p, PSTR("LAYER:"), 6) || !strncmp_P(p, PSTR("LAYER_CHANGE"), 12)
+      || (!strncmp_P(p, PSTR(" layer "), 7) && NUMERIC(p[7]))
+    ) {
+      modal.pos = line_pos;
+      batch[batch_count++] = modal;
+      header.layers++;
+    }
+    return;
+  }
+
+  // Skip a line number
+  if (*p == 'N') {
+    p = strchr(p, ' ');
+    if (!p) return;
+    while (*p == ' ') p++;
+  }
+
+  const char letter = *p++;
+  const int code = atoi(p);
+  float v;
+  if (letter == 'G') switch (code) {
+    case 0: case 1: case 2: case 3:
+      LOOP_XYZ(a) if (seen(p, axis_codes[a], v)) {
+        if (modal.flags & PRINT_INDEX_XYZ_RELATIVE) modal.xyz[a] += v; else modal.xyz[a] = v;
+      }
+      if (seen(p, 'E', v)) {
+        const float de = (modal.flags & PRINT_INDEX_E_RELATIVE) ? v : v - modal.e_pos;
+        modal.e_pos += de;
+        modal.e_total += de;
+      }
+      if (seen(p, 'F', v)) modal.feedrate = v;
+      break;
+    case 90: modal.flags &= ~(PRINT_INDEX_E_RELATIVE | PRINT_INDEX_XYZ_RELATIVE); break;
+    case 91: modal.flags |= PRINT_INDEX_E_RELATIVE | PRINT_INDEX_XYZ_RELATIVE; break;
+    case 92:
+      LOOP_XYZ(a) if (seen(p, axis_codes[a], v)) modal.xyz[a] = v;
+      if (seen(p, 'E', v)) modal.e_pos = v;
+      break;
+  }
+  else if (letter == 'M') switch (code) {
+    case 82: modal.flags &= ~PRINT_INDEX_E_RELATIVE; break;
+    case 83: modal.flags |= PRINT_INDEX_E_RELATIVE; break;
+    case 104: case 109:
+      if (!(seen(p, 'T', v) && v) && seen(p, 'S', v)) modal.hotend = v;
+      break;
+    case 140: case 190:
+      if (seen(p, 'S', v)) modal.bed = v;
+      break;
+    case 106:
+      if (!(seen(p, 'P', v) && v)) modal.fan = seen(p, 'S', v) ? constrain(v, 0, 255) : 255;
+      break;
+    case 107:
+      if (!(seen(p, 'P', v) && v)) modal.fan = 0;
+      break;
+  }
+}
+
+bool PrintIndex::flush_batch() {
+  const int16_t size = batch_count * sizeof(print_index_record_t);
+  batch_count = 0;
+  return !size || index_file.write(batch, size) == size;
+}
+
+// Write the header to make the index valid, and start using it
+void PrintIndex::finish_build() {
+  scan_file.close();
+
+  bool ok = true;
+  if (line_len) {
+    if (batch_count == COUNT(batch)) ok = flush_batch();
+    line[line_len] = '\0';
+    parse_line();
+  }
+
+  header.magic = PRINT_INDEX_MAGIC;
+  header.e_total = modal.e_total;
+  ok = ok && flush_batch()
+       && index_file.seekSet(0)
+       && index_file.write(&header, sizeof(header)) == sizeof(header)
+       && index_file.sync();
+
+  if (ok && header.layers && set_layer(0))
+    state = LOADED;
+  else
+    close();
+}
+
+/**
+ * Progress as a share of the filament used, which tracks print
+ * time better than bytes do. Interpolated within a layer.
+ */
+uint16_t PrintIndex::permyriad(const uint32_t sdpos) {
+  if (header.e_total <= 0) return 0;
+
+  const bool last = cur_layer + 1 >= header.layers;
+  const uint32_t end_pos = last ? header.file_size : next.pos;
+  const float end_e = last ? header.e_total : next.e_total;
+
+  float e = cur.e_total;
+  if (sdpos > cur.pos && end_pos > cur.pos)
+    e += (end_e - cur.e_total) * float(_MIN(sdpos, end_pos) - cur.pos) / float(end_pos - cur.pos);
+
+  return constrain(e * 10000 / header.e_total, 0, 10000);
+}
+
+/**
+ * Set the print position to the start of a layer. Call with the print paused
+ * or not yet started, and with XYZ homed. Lines read ahead from SD are dropped.
+ * Wait for the temperatures the layer expects, move to the position where it
+ * starts, and restore the fan speed, feedrate and E position.
+ */
+bool PrintIndex::seek_layer(const uint32_t n) {
+  if (!loaded() || n >= header.layers || !set_layer(n)) return false;
+
+  queue.ring_buffer.drop_unacked();
+  card.setIndex(cur.pos);
+
+  char cmd[20], str_1[16];
+  #if HAS_HEATED_BED
+    sprintf_P(cmd, PSTR("M190 S%i"), cur.bed);
+    gcode.process_subcommands_now(cmd);
+  #endif
+  #if HAS_HOTEND
+    sprintf_P(cmd, PSTR("M109 S%i"), cur.hotend);
+    gcode.process_subcommands_now(cmd);
+  #endif
+
+  // Travel above both the current and the layer height, then lower the nozzle
+  xyz_pos_t pos = cur.xyz;
+  toNative(pos);
+  do_blocking_move_to_z(_MIN(_MAX(current_position.z, pos.z) + (PRINT_INDEX_ZRAISE), Z_MAX_POS));
+  do_blocking_move_to_xy(pos);
+  do_blocking_move_to_z(pos.z);
+
+  #if HAS_FAN
+    sprintf_P(cmd, PSTR("M106 S%i"), cur.fan);
+    gcode.process_subcommands_now(cmd);
+  #endif
+  if (cur.feedrate) {
+    sprintf_P(cmd, PSTR("G1 F%u"), cur.feedrate);
+    gcode.process_subcommands_now(cmd);
+  }
+  gcode.process_subcommands_now_P((cur.flags & PRINT_INDEX_E_RELATIVE) ? PSTR("M83") : PSTR("M82"));
+  sprintf_P(cmd, PSTR("G92 E%s"), dtostrf(cur.e_pos, 1, 3, str_1));
+  gcode.process_subcommands_now(cmd);
+
+  return true;
+}
+
+#endif // SD_PRINT_INDEX
@@ -0,0 +1,102 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/print_index.h - Layer index for SD print files
+ *
+ * A sidecar file (JOB.GCO => JOB.IDX) records where each layer starts,
+ * the filament used up to that point, and the modal state a print needs
+ * to start from there. It's built in idle time the first time a file is
+ * opened, then loaded on later opens, as long as the print file's size and
+ * modified time still match.
+ */
+
+#include "../sd/SdFile.h"
+
+#define PRINT_INDEX_MAGIC   0x5844494D  // 'MIDX'
+#define PRINT_INDEX_VERSION 2
+
+#define PRINT_INDEX_E_RELATIVE   _BV(0)
+#define PRINT_INDEX_XYZ_RELATIVE _BV(1)
+
+typedef struct {
+  uint32_t magic;               // PRINT_INDEX_MAGIC once the index is complete
+  uint16_t version, record_size;
+  uint32_t file_size;           // Print file size
+  uint16_t date, time;          // Print file modified date and time
+  uint32_t layers;              // Number of records that follow
+  float e_total;                // Filament used by the whole file
+} print_index_header_t;
+
+typedef struct {
+  uint32_t pos;                 // File position of the layer marker
+  xyz_pos_t xyz;                // Logical XYZ position
+  float e_pos, e_total;         // Logical E position and filament used so far
+  uint16_t feedrate;            // Feedrate (mm/min)
+  int16_t hotend, bed;          // Target temperatures
+  uint8_t fan;                  // Fan 0 speed
+  uint8_t flags;                // PRINT_INDEX_E_RELATIVE, PRINT_INDEX_XYZ_RELATIVE
+} print_index_record_t;
+
+class PrintIndex {
+public:
+  static void open(SdFile &dir, SdFile &file, const char * const fname);
+  static void close();
+  static void remove(SdFile &dir, const char * const fname);
+  static void task();
+
+  static inline bool loaded() { return state == LOADED; }
+  static inline uint32_t layers() { return header.layers; }
+  static inline uint32_t layer() { return cur_layer; }
+
+  static uint16_t permyriad(const uint32_t sdpos);
+  static bool seek_layer(const uint32_t n);
+
+private:
+  enum State : uint8_t { IDLE, BUILDING, LOADED };
+  static State state;
+
+  static SdFile index_file, scan_file;
+  static print_index_header_t header;
+
+  // Current layer, to follow the print position
+  static uint32_t cur_layer;
+  static print_index_record_t cur, next;
+  static bool read_record(const uint32_t n, print_index_record_t &rec);
+  static bool set_layer(const uint32_t n);
+
+  // Index builder
+  static char line[MAX_CMD_SIZE];
+  static uint8_t line_len;
+  static bool line_comment;
+  static uint32_t scan_pos, line_pos;
+  static print_index_record_t modal;
+  static print_index_record_t batch[8];
+  static uint8_t batch_count;
+  static uint16_t scan(const char *buf, const uint16_t len);
+  static void parse_line();
+  static bool flush_batch();
+  static void finish_build();
+};
+
+extern PrintIndex print_index;
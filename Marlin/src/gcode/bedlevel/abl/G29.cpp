@@ -53,6 +53,10 @@
   #include "../../../libs/vector_3.h"
 #endif
 
+#if ENABLED(PROBE_PATH_OPTIMIZER)
+  #include "../../../feature/bedlevel/probe_path.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../../../core/debug_out.h"
 
@@ -80,6 +84,14 @@
 
 #define G29_RETURN(b) return TERN_(G29_RETRY_AND_RECOVER, b)
 
+#if BOTH(PROBE_PATH_OPTIMIZER, IS_KINEMATIC) && DISABLED(AUTO_BED_LEVELING_LINEAR)
+  // Leave points outside the round or hexagonal area out of the probe path
+  static bool probe_path_can_reach(const uint8_t, const uint8_t, const xy_pos_t &pos) { return probe.can_reach(pos); }
+  #define PROBE_PATH_FILTER probe_path_can_reach
+#else
+  #define PROBE_PATH_FILTER nullptr
+#endif
+
 // For manual probing values persist over multiple G29
 class G29_State {
 public:
@@ -599,35 +611,52 @@ G29_TYPE GcodeSuite::G29() {
 
     #if ABL_USES_GRID
 
-      bool zig = PR_OUTER_SIZE & 1;  // Always end at RIGHT and BACK_PROBE_BED_POSITION
-
       abl.measured_z = 0;
 
-      // Outer loop is X with PROBE_Y_FIRST enabled
-      // Outer loop is Y with PROBE_Y_FIRST disabled
-      for (PR_OUTER_VAR = 0; PR_OUTER_VAR < PR_OUTER_SIZE && !isnan(abl.measured_z); PR_OUTER_VAR++) {
+      #if ENABLED(PROBE_PATH_OPTIMIZER)
 
-        int8_t inStart, inStop, inInc;
+        // Visit the grid points in the planned order
+        const probe_path_index_t path_points = probe_path.plan(
+          abl.grid_points, abl.probe_position_lf, abl.gridSpacing,
+          current_position + probe.offset_xy, PROBE_PATH_FILTER
+        );
 
-        if (zig) {                      // Zig away from origin
-          inStart = 0;                  // Left or front
-          inStop = PR_INNER_SIZE;       // Right or back
-          inInc = 1;                    // Zig right
-        }
-        else {                          // Zag towards origin
-          inStart = PR_INNER_SIZE - 1;  // Right or back
-          inStop = -1;                  // Left or front
-          inInc = -1;                   // Zag left
-        }
+        for (probe_path_index_t pt_index = 1; pt_index <= path_points && !isnan(abl.measured_z); pt_index++) {
+
+          const xy_uint8_t ij = probe_path.point(pt_index - 1);
+          abl.meshCount.set(ij.x, ij.y);
+
+      #else
 
-        zig ^= true; // zag
+        bool zig = PR_OUTER_SIZE & 1;  // Always end at RIGHT and BACK_PROBE_BED_POSITION
 
-        // An index to print current state
-        uint8_t pt_index = (PR_OUTER_VAR) * (PR_INNER_SIZE) + 1;
+        // Outer loop is X with PROBE_Y_FIRST enabled
+        // Outer loop is Y with PROBE_Y_FIRST disabled
+        for (PR_OUTER_VAR = 0; PR_OUTER_VAR < PR_OUTER_SIZE && !isnan(abl.measured_z); PR_OUTER_VAR++) {
 
-        // Inner loop is Y with PROBE_Y_FIRST enabled
-        // Inner loop is X with PROBE_Y_FIRST disabled
-        for (PR_INNER_VAR = inStart; PR_INNER_VAR != inStop; pt_index++, PR_INNER_VAR += inInc) {
+          int8_t inStart, inStop, inInc;
+
+          if (zig) {                      // Zig away from origin
+            inStart = 0;                  // Left or front
+            inStop = PR_INNER_SIZE;       // Right or back
+            inInc = 1;                    // Zig right
+          }
+          else {                          // Zag towards origin
+            inStart = PR_INNER_SIZE - 1;  // Right or back
+            inStop = -1;                  // Left or front
+            inInc = -1;                   // Zag left
+          }
+
+          zig ^= true; // zag
+
+          // An index to print current state
+          uint8_t pt_index = (PR_OUTER_VAR) * (PR_INNER_SIZE) + 1;
+
+          // Inner loop is Y with PROBE_Y_FIRST enabled
+          // Inner loop is X with PROBE_Y_FIRST disabled
+          for (PR_INNER_VAR = inStart; PR_INNER_VAR != inStop; pt_index++, PR_INNER_VAR += inInc) {
+
+      #endif
 
           abl.probePos = abl.probe_position_lf + abl.gridSpacing * abl.meshCount.asFloat();
 
@@ -673,8 +702,12 @@ G29_TYPE GcodeSuite::G29() {
           abl.reenable = false;
           idle_no_sleep();
 
-        } // inner
-      } // outer
+      #if ENABLED(PROBE_PATH_OPTIMIZER)
+        } // path
+      #else
+          } // inner
+        } // outer
+      #endif
 
     #elif ENABLED(AUTO_BED_LEVELING_3POINT)
 
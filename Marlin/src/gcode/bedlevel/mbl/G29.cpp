@@ -99,6 +99,10 @@ void GcodeSuite::G29() {
       }
       // For each G29 S2...
       if (mbl_probe_index == 0) {
+        #if ENABLED(PROBE_PATH_OPTIMIZER)
+          // Plan the order of all mesh points from the current position
+          probe_path.plan({ GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y }, { MESH_MIN_X, MESH_MIN_Y }, { MESH_X_DIST, MESH_Y_DIST }, current_position);
+        #endif
         // Move close to the bed before the first point
         do_blocking_move_to_z(0.4f
           #ifdef MANUAL_PROBE_START_Z
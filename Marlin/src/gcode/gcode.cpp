@@ -264,6 +264,45 @@ void GcodeSuite::dwell(millis_t time) {
 
 #endif // HAS_LEVELING && G29_RETRY_AND_RECOVER
 
+#if ENABLED(GCODE_DISPATCH_STATS)
+
+  /**
+   * Count the commands run and the time spent in their handlers, for D8.
+   * The table is small and open-addressed, so only the first 32 different
+   * commands are counted. Time spent in nested commands is counted twice.
+   */
+  typedef struct {
+    char letter;
+    uint16_t codenum;
+    uint32_t count, us;
+  } dispatch_stat_t;
+
+  static dispatch_stat_t dispatch_stats[32];
+
+  static void dispatch_stats_add(const char letter, const uint16_t codenum, const uint32_t us) {
+    constexpr uint8_t mask = COUNT(dispatch_stats) - 1;
+    uint8_t i = (codenum ^ (letter << 3)) & mask;
+    LOOP_L_N(n, COUNT(dispatch_stats)) {
+      dispatch_stat_t &st = dispatch_stats[i];
+      if (!st.letter) { st.letter = letter; st.codenum = codenum; }
+      if (st.letter == letter && st.codenum == codenum) { st.count++; st.us += us; return; }
+      i = (i + 1) & mask;
+    }
+  }
+
+  void GcodeSuite::report_dispatch_stats() {
+    for (const dispatch_stat_t &st : dispatch_stats) {
+      if (!st.letter) continue;
+      SERIAL_CHAR(st.letter);
+      SERIAL_ECHO(st.codenum);
+      SERIAL_ECHOLNPAIR(" count:", st.count, " us:", st.us, " avg:", st.us / st.count);
+    }
+  }
+
+  void GcodeSuite::reset_dispatch_stats() { ZERO(dispatch_stats); }
+
+#endif
+
 /**
  * Process the parsed command and dispatch it to its handler
  */
@@ -289,14 +328,21 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
     }
   #endif
 
+  #if ENABLED(GCODE_DISPATCH_STATS)
+    const uint32_t dispatch_start = micros();
+  #endif
+
   // Handle a known command or reply "unknown command"
 
-  switch (parser.command_letter) {
+  // G0 and G1 are most of a print, so they skip the big switch. The rest stays
+  // a switch. GCC lowers it to jump tables and a short compare tree, which beats
+  // a sorted table lookup, and it calls handlers directly with their arguments.
+  if (parser.command_letter == 'G' && parser.codenum <= 1)          // G0: Fast Move, G1: Linear Move
+    G0_G1(TERN_(HAS_FAST_MOVES, parser.codenum == 0));
 
-    case 'G': switch (parser.codenum) {
+  else switch (parser.command_letter) {
 
-      case 0: case 1:                                             // G0: Fast Move, G1: Linear Move
-        G0_G1(TERN_(HAS_FAST_MOVES, parser.codenum == 0)); break;
+    case 'G': switch (parser.codenum) {
 
       #if ENABLED(ARC_SUPPORT) && DISABLED(SCARA)
         case 2: case 3: G2_G3(parser.codenum == 2); break;        // G2: CW ARC, G3: CCW ARC
@@ -835,6 +881,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 575: M575(); break;                                  // M575: Set serial baudrate
       #endif
 
+      #if ENABLED(SERIAL_FLOW_CREDITS)
+        case 577: M577(); break;                                  // M577: Serial flow credits
+      #endif
+
       #if ENABLED(ADVANCED_PAUSE_FEATURE)
         case 600: M600(); break;                                  // M600: Pause for Filament Change
         case 603: M603(); break;                                  // M603: Configure Filament Change
@@ -1020,6 +1070,8 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
       parser.unknown_command_warning();
   }
 
+  TERN_(GCODE_DISPATCH_STATS, dispatch_stats_add(parser.command_letter, parser.codenum, micros() - dispatch_start));
+
   if (!no_ok) queue.ok_to_send();
 
   SERIAL_OUT(msgDone); // Call the msgDone serial hook to signal command processing done
@@ -1042,7 +1094,21 @@ void GcodeSuite::process_next_command() {
 
   if (DEBUGGING(ECHO)) {
     SERIAL_ECHO_START();
-    SERIAL_ECHOLN(command.buffer);
+    #if HAS_PARSED_GCODE
+      if (command.is_parsed()) {
+        // Show a pre-parsed command as text
+        SERIAL_CHAR(command.parsed.letter);
+        SERIAL_ECHO(command.parsed.codenum);
+        uint8_t n = 0;
+        LOOP_L_N(i, 26) if (TEST32(command.parsed.codebits, i)) {
+          SERIAL_CHAR(' ', 'A' + i);
+          SERIAL_ECHO_F(command.parsed.value[n++], 4);
+        }
+        SERIAL_EOL();
+      }
+      else
+    #endif
+        SERIAL_ECHOLN(queue.ring_buffer.peek_next_command_string());
     #if ENABLED(M100_FREE_MEMORY_DUMPER)
       SERIAL_ECHOPAIR("slot:", queue.ring_buffer.index_r);
       M100_dump_routine(PSTR("   Command Queue:"), (const char*)&queue.ring_buffer, sizeof(queue.ring_buffer));
@@ -1050,7 +1116,12 @@ void GcodeSuite::process_next_command() {
   }
 
   // Parse the next command in the queue
-  parser.parse(command.buffer);
+  #if HAS_PARSED_GCODE
+    if (command.is_parsed())
+      parser.load(command.parsed);        // Already parsed
+    else
+  #endif
+      parser.parse(TERN(PREPARSED_GCODE_QUEUE, queue.ring_buffer.peek_next_command_string(), command.buffer));
   process_parsed_command();
 }
 
@@ -1059,8 +1130,19 @@ void GcodeSuite::process_next_command() {
  * G-code "macros" to be called from within other G-code handlers.
  */
 
+// Parse the saved command again, from text or from its pre-parsed form
+static void restore_parser(char * const saved_cmd, const bool saved_loaded) {
+  #if HAS_PARSED_GCODE
+    if (saved_loaded) return parser.load(*(parsed_gcode_t*)saved_cmd);
+  #else
+    UNUSED(saved_loaded);
+  #endif
+  parser.parse(saved_cmd);
+}
+
 void GcodeSuite::process_subcommands_now_P(PGM_P pgcode) {
   char * const saved_cmd = parser.command_ptr;        // Save the parser state
+  const bool saved_loaded = TERN0(HAS_PARSED_GCODE, parser.is_loaded());
   for (;;) {
     PGM_P const delim = strchr_P(pgcode, '\n');       // Get address of next newline
     const size_t len = delim ? delim - pgcode : strlen_P(pgcode); // Get the command length
@@ -1072,11 +1154,12 @@ void GcodeSuite::process_subcommands_now_P(PGM_P pgcode) {
     if (!delim) break;                                // Last command?
     pgcode = delim + 1;                               // Get the next command
   }
-  parser.parse(saved_cmd);                            // Restore the parser state
+  restore_parser(saved_cmd, saved_loaded);            // Restore the parser state
 }
 
 void GcodeSuite::process_subcommands_now(char * gcode) {
   char * const saved_cmd = parser.command_ptr;        // Save the parser state
+  const bool saved_loaded = TERN0(HAS_PARSED_GCODE, parser.is_loaded());
   for (;;) {
     char * const delim = strchr(gcode, '\n');         // Get address of next newline
     if (delim) *delim = '\0';                         // Replace with nul
@@ -1086,7 +1169,7 @@ void GcodeSuite::process_subcommands_now(char * gcode) {
     *delim = '\n';                                    // Put back the newline
     gcode = delim + 1;                                // Get the next command
   }
-  parser.parse(saved_cmd);                            // Restore the parser state
+  restore_parser(saved_cmd, saved_loaded);            // Restore the parser state
 }
 
 #if ENABLED(HOST_KEEPALIVE_FEATURE)
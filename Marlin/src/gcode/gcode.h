@@ -241,6 +241,7 @@
  * M553 - Get or set IP netmask. (Requires enabled Ethernet port)
  * M554 - Get or set IP gateway. (Requires enabled Ethernet port)
  * M569 - Enable stealthChop on an axis. (Requires at least one _DRIVER_TYPE to be TMC2130/2160/2208/2209/5130/5160)
+ * M577 - Enable/disable serial flow credits for the host port. (Requires SERIAL_FLOW_CREDITS)
  * M600 - Pause for filament change: "M600 X<pos> Y<pos> Z<raise> E<first_retract> L<later_retract>". (Requires ADVANCED_PAUSE_FEATURE)
  * M603 - Configure filament change: "M603 T<tool> U<unload_length> L<load_length>". (Requires ADVANCED_PAUSE_FEATURE)
  * M605 - Set Dual X-Carriage movement mode: "M605 S<mode> [X<x_offset>] [R<temp_offset>]". (Requires DUAL_X_CARRIAGE)
@@ -425,6 +426,11 @@ private:
     static void D(const int16_t dcode);
   #endif
 
+  #if ENABLED(GCODE_DISPATCH_STATS)
+    static void report_dispatch_stats();
+    static void reset_dispatch_stats();
+  #endif
+
   static void G0_G1(TERN_(HAS_FAST_MOVES, const bool fast_move=false));
 
   #if ENABLED(ARC_SUPPORT)
@@ -947,6 +953,10 @@ private:
     static void M575();
   #endif
 
+  #if ENABLED(SERIAL_FLOW_CREDITS)
+    static void M577();
+  #endif
+
   #if ENABLED(ADVANCED_PAUSE_FEATURE)
     static void M600();
     static void M603();
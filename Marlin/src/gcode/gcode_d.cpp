@@ -32,6 +32,10 @@
   #include "../sd/cardreader.h"
   #include "../MarlinCore.h" // for kill
 
+  #if ENABLED(SCARA_TRIG_TABLE)
+    #include "../module/scara.h"
+  #endif
+
   extern void dump_delay_accuracy_check();
 
   /**
@@ -178,6 +182,12 @@
         SERIAL_ECHOLN(gtn(&SERIAL_IMPL));
         break;
 
+      #if ENABLED(GCODE_DISPATCH_STATS)
+        case 8: // D8 Report the count and handler time of each command. D8 R to reset.
+          if (parser.seen('R')) reset_dispatch_stats(); else report_dispatch_stats();
+          break;
+      #endif
+
       case 100: { // D100 Disable heaters and attempt a hard hang (Watchdog Test)
         SERIAL_ECHOLNPGM("Disabling heaters and attempting to trigger Watchdog");
         SERIAL_ECHOLNPGM("(USE_WATCHDOG " TERN(USE_WATCHDOG, "ENABLED", "DISABLED") ")");
@@ -243,8 +253,92 @@
           card.closefile();
         } break;
 
+        case 103: { // D103 Benchmark reading the lines of a file: D103 <filename>
+          card.openFileRead(parser.string_arg);
+          if (!card.isFileOpen()) return;
+
+          // Count the lines and checksum the characters outside of comments,
+          // first scanning in place as SD printing does, then with get()
+          uint32_t lines[2] = { 0 }, sum[2] = { 0 }, us[2];
+          LOOP_L_N(pass, 2) {
+            card.setIndex(0);
+            bool comment = false;
+            const uint32_t start = micros();
+            auto scan = [&](const char c) {
+              if (c == '\n') { lines[pass]++; comment = false; }
+              else if (c == ';') comment = true;
+              else if (!comment) sum[pass] = sum[pass] * 31 + c;
+            };
+            if (pass == 0) {
+              while (!card.eof()) {
+                const char *block;
+                const uint16_t n = card.peek(block);
+                if (!n) break;
+                for (uint16_t i = 0; i < n; i++) scan(block[i]);
+                card.advance(n);
+              }
+            }
+            else
+              for (int16_t c; (c = card.get()) >= 0;) scan(c);
+            us[pass] = micros() - start;
+            TERN_(USE_WATCHDOG, watchdog_refresh());
+          }
+          card.closefile();
+
+          SERIAL_ECHOLNPAIR("D103 lines:", lines[0], " scan:", us[0], "us get:", us[1], "us", lines[0] == lines[1] && sum[0] == sum[1] ? " match" : " MISMATCH");
+        } break;
+
       #endif // SDSUPPORT
 
+      case 104: { // D104 Compare parse_float with strtof bit for bit and time both: D104 C<count>
+        static const char * const edge_cases[] = {
+          "0", "-0", "+1", ".5", "-.5", "5.", "-", ".", "16777215", "16777216", "16777217",
+          "0.0000000001", "0.00000000001", "123456789012", "3.4028235", "99999.99999", "0.1", "-273.15"
+        };
+
+        uint32_t numbers = 0, mismatches = 0, us[2] = { 0 };
+        auto compare = [&](const char * const text, const float a, const float b) {
+          numbers++;
+          if (memcmp(&a, &b, sizeof(float)) && !mismatches++) SERIAL_ECHOLNPAIR("D104 mismatch: ", text);
+        };
+        for (const char * const text : edge_cases)
+          compare(text, GCodeParser::parse_float(text), strtof(text, nullptr));
+
+        // Slicer-style numbers from a fixed sequence. Every 16th one is too long for the fast path.
+        const uint32_t count = parser.ulongval('C', 100000);
+        uint32_t seed = 104;
+        auto rnd = [&](const uint8_t range) { seed = seed * 1664525UL + 1013904223UL; return uint8_t((seed >> 16) % range); };
+        char text[64][24];
+        float value[2][COUNT(text)];
+        while (numbers < count) {
+          LOOP_L_N(n, COUNT(text)) {
+            char *p = text[n];
+            if (!rnd(8)) *p++ = '-';
+            const uint8_t whole = rnd(5) + 1, decimals = (n & 15) == 15 ? 12 : rnd(6);
+            LOOP_L_N(i, whole) *p++ = '0' + rnd(10);
+            if (decimals) *p++ = '.';
+            LOOP_L_N(i, decimals) *p++ = '0' + rnd(10);
+            *p = '\0';
+          }
+          uint32_t start = micros();
+          LOOP_L_N(n, COUNT(text)) value[0][n] = GCodeParser::parse_float(text[n]);
+          us[0] += micros() - start;
+          start = micros();
+          LOOP_L_N(n, COUNT(text)) value[1][n] = strtof(text[n], nullptr);
+          us[1] += micros() - start;
+          LOOP_L_N(n, COUNT(text)) compare(text[n], value[0][n], value[1][n]);
+          TERN_(USE_WATCHDOG, watchdog_refresh());
+        }
+
+        SERIAL_ECHOLNPAIR("D104 numbers:", numbers, " mismatches:", mismatches, " parse_float:", us[0], "us strtof:", us[1], "us");
+      } break;
+
+      #if ENABLED(SCARA_TRIG_TABLE)
+        case 105: // D105 Compare the SCARA trig tables with the math library and time both: D105 C<count>
+          scara_trig_report(parser.ulongval('C', 100000));
+          break;
+      #endif
+
       #if ENABLED(POSTMORTEM_DEBUGGING)
 
         case 451: { // Trigger all kind of faults to test exception catcher
@@ -122,6 +122,9 @@ void GcodeSuite::M115() {
     // SDCARD (M20, M23, M24, etc.)
     cap_line(PSTR("SDCARD"), ENABLED(SDSUPPORT));
 
+    // PAGED_LISTING (M20 S C T)
+    cap_line(PSTR("PAGED_LISTING"), ENABLED(M20_PAGED_LISTING));
+
     // REPEAT (M808)
     cap_line(PSTR("REPEAT"), ENABLED(GCODE_REPEAT_MARKERS));
 
@@ -155,6 +158,12 @@ void GcodeSuite::M115() {
     // MEATPACK Compression
     cap_line(PSTR("MEATPACK"), SERIAL_IMPL.has_feature(port, SerialFeature::MeatPack));
 
+    // SERIAL_FLOW_CREDITS (M577)
+    cap_line(PSTR("FLOW_CREDITS"), ENABLED(SERIAL_FLOW_CREDITS));
+
+    // BINARY_GCODE (0xFF 0xFF 0xF5)
+    cap_line(PSTR("BINARY_GCODE"), ENABLED(BINARY_GCODE));
+
     // Machine Geometry
     #if ENABLED(M115_GEOMETRY_REPORT)
       const xyz_pos_t dmin = { X_MIN_POS, Y_MIN_POS, Z_MIN_POS },
@@ -0,0 +1,92 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(SERIAL_FLOW_CREDITS)
+
+#include "../gcode.h"
+#include "../queue.h"
+
+/**
+ * M577: Serial flow credits for the port that sent the command
+ *
+ *   S<bool> Enable or disable credits in "ok" replies
+ *
+ * Reports "FLOW_CREDITS:<state> W<window> C<count> B<free>"
+ *
+ * With credits enabled each "ok" ends with C<count>, the number of bytes read
+ * from the port so far, modulo 65536, and B<free>, the free command queue
+ * slots. Up to W bytes can wait in the port's RX buffer, so a host that has
+ * sent 'sent' bytes can keep sending while
+ *
+ *   (sent - C) mod 65536 < W
+ *
+ * without waiting for an "ok" per line. Send M577 S1 and wait for the reply
+ * before streaming, so 'sent' and C start out equal. Don't send empty lines,
+ * since they use credits without a reply to return them.
+ *
+ * With SERIAL_OUTPUT_BUFFER the replies to a port with credits enabled are
+ * held and sent together every few ms, so several "ok" lines and reports
+ * share a packet.
+ */
+
+/**
+ * Bytes the host may send ahead on a port. A UART drops bytes once its RX
+ * buffer is full. A USB CDC port (-1) and the simulator's serial hold the
+ * host off instead, so there the window only keeps C from wrapping around.
+ */
+static uint16_t credit_window(const serial_index_t port) {
+  #ifdef __PLAT_LINUX__
+    UNUSED(port);
+  #else
+    int8_t num;
+    switch (port.index) {
+      default: num = SERIAL_PORT; break;
+      #ifdef SERIAL_PORT_2
+        case 1: num = SERIAL_PORT_2; break;
+      #endif
+      #ifdef SERIAL_PORT_3
+        case 2: num = SERIAL_PORT_3; break;
+      #endif
+    }
+    if (num >= 0) return RX_BUFFER_SIZE - 1;
+  #endif
+  return 0x7FFF;
+}
+
+void GcodeSuite::M577() {
+  const serial_index_t port = queue.ring_buffer.command_port();
+  if (!port.valid()) return;        // Not from a serial port
+  GCodeQueue::SerialState &serial = queue.serial_state[port.index];
+
+  if (parser.seen('S')) {
+    serial.credits = parser.value_bool();
+    #if SERIAL_OUTPUT_BUFFER
+      SERIAL_HOLD_OUTPUT(port, serial.credits);
+    #endif
+  }
+
+  SERIAL_ECHOLNPAIR("FLOW_CREDITS:", int(serial.credits), " W", credit_window(port), " C", serial.bytes_read, " B", BUFSIZE - queue.ring_buffer.length);
+}
+
+#endif // SERIAL_FLOW_CREDITS
@@ -66,6 +66,10 @@ uint16_t GCodeParser::codenum;
   char *GCodeParser::command_args; // start of parameters
 #endif
 
+#if HAS_PARSED_GCODE
+  const float *GCodeParser::parsed_values; // = nullptr
+#endif
+
 // Create a global instance of the GCode parser singleton
 GCodeParser parser;
 
@@ -84,6 +88,7 @@ void GCodeParser::reset() {
     codebits = 0;                       // No codes yet
     //ZERO(param);                      // No parameters (should be safe to comment out this line)
   #endif
+  TERN_(HAS_PARSED_GCODE, parsed_values = nullptr); // Values come from the command line
 }
 
 #if ENABLED(GCODE_QUOTED_STRINGS)
@@ -106,6 +111,226 @@ void GCodeParser::reset() {
 
 #endif
 
+#if HAS_PARSED_GCODE
+
+  /**
+   * Populate the command line state from a pre-parsed command.
+   * Parameter indexes point into the parsed values instead of the string.
+   */
+  void GCodeParser::load(const parsed_gcode_t &cmd) {
+    reset();
+    command_ptr = (char*)&cmd.nul;        // An empty string to echo
+    command_letter = cmd.letter;
+    codenum = cmd.codenum;
+    codebits = cmd.codebits;
+    uint8_t n = 0;
+    LOOP_L_N(i, COUNT(param)) if (TEST32(codebits, i)) param[i] = n++;
+    parsed_values = cmd.value;
+
+    #if ENABLED(GCODE_MOTION_MODES)
+      if (command_letter == 'G' && (codenum <= TERN(ARC_SUPPORT, 3, 1) || codenum == 5)) {
+        motion_mode_codenum = codenum;
+        TERN_(USE_GCODE_SUBCODES, motion_mode_subcode = 0);
+      }
+    #endif
+  }
+
+#endif
+
+/**
+ * Parse a G-code number: [-+]?[0-9]*(.[0-9]*)?
+ *
+ * Slicer output like "123.456" has a short mantissa and a few decimals. When
+ * the mantissa fits in 24 bits and there are 10 decimals or less, both it and
+ * the power of 10 are exact floats, so one division gives the same correctly
+ * rounded result as strtof. Longer numbers are passed on to strtof.
+ */
+float GCodeParser::parse_float(const char *p, const char **end/*=nullptr*/) {
+  static const float pow10[] PROGMEM = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10 };
+
+  while (*p == ' ') ++p;
+  const char * const start = p;
+  const bool neg = (*p == '-');
+  if (neg || *p == '+') ++p;
+
+  uint32_t mant = 0;
+  uint8_t decimals = 0;
+  bool digits = false, slow = false;
+  for (; NUMERIC(*p); ++p) {
+    mant = mant * 10 + (*p - '0');
+    if (mant > _BV32(24)) slow = true;
+    digits = true;
+  }
+  if (*p == '.')
+    for (++p; NUMERIC(*p); ++p) {
+      mant = mant * 10 + (*p - '0');
+      if (mant > _BV32(24) || ++decimals >= COUNT(pow10)) slow = true;
+      digits = true;
+    }
+
+  if (end) *end = p;
+  if (!digits) return 0;
+
+  if (slow) {
+    // An 'E' after the number is a parameter, not an exponent. Copy the
+    // number so strtof doesn't read it.
+    if (*p != 'E' && *p != 'e') return strtof(start, nullptr);
+    const size_t len = p - start;
+    char num[len + 1];
+    memcpy(num, start, len);
+    num[len] = '\0';
+    return strtof(num, nullptr);
+  }
+
+  float v = mant;
+  if (decimals) v /= pgm_read_float(&pow10[decimals]);
+  return neg ? -v : v;
+}
+
+#if ENABLED(PREPARSED_GCODE_QUEUE)
+
+  /**
+   * The commands that can be pre-parsed and the parameters each one takes.
+   * Only commands that take numeric parameters are included, so the handlers
+   * never need the text. Parameters are only listed here if a handler reads
+   * them, so a line with any other letter is kept as text.
+   *
+   * There's a table for each command letter, sorted by code for a binary search.
+   */
+  typedef struct { uint16_t codenum; uint32_t params; } gcode_schema_t;
+
+  #define _XYZEF     GCodeParser::letter_bits("XYZEF")
+  #define _MIXING    TERN0(DIRECT_MIXING_IN_G1, GCodeParser::letter_bits("ABCDHI"))
+  #define _TEMP      GCodeParser::letter_bits("BFIRST")
+
+  static constexpr gcode_schema_t preparse_schema_G[] PROGMEM = {
+    {   0, _XYZEF | _MIXING | GCodeParser::letter_bits("S") },
+    {   1, _XYZEF | _MIXING | GCodeParser::letter_bits("S") },
+    {   2, _XYZEF | _MIXING | GCodeParser::letter_bits("IJKPRS") },
+    {   3, _XYZEF | _MIXING | GCodeParser::letter_bits("IJKPRS") },
+    {   4, GCodeParser::letter_bits("PS") },
+    {   5, _XYZEF | _MIXING | GCodeParser::letter_bits("IJPQS") },
+    {  10, GCodeParser::letter_bits("S") },
+    {  11, 0 },
+    {  92, GCodeParser::letter_bits("XYZE") }
+  };
+
+  static constexpr gcode_schema_t preparse_schema_M[] PROGMEM = {
+    {  73, GCodeParser::letter_bits("PR") },
+    {  82, 0 },
+    {  83, 0 },
+    { 104, _TEMP },
+    { 106, GCodeParser::letter_bits("AIPST") },
+    { 107, GCodeParser::letter_bits("P") },
+    { 109, _TEMP },
+    { 140, GCodeParser::letter_bits("IRS") },
+    { 190, GCodeParser::letter_bits("IRS") },
+    { 204, GCodeParser::letter_bits("PRST") },
+    { 220, GCodeParser::letter_bits("BRS") },
+    { 221, GCodeParser::letter_bits("ST") },
+    { 400, 0 }
+  };
+
+  #undef _XYZEF
+  #undef _MIXING
+  #undef _TEMP
+
+  constexpr bool schema_sorted(const gcode_schema_t * const table, const uint8_t n) {
+    return n < 2 || (table[0].codenum < table[1].codenum && schema_sorted(table + 1, n - 1));
+  }
+  static_assert(schema_sorted(preparse_schema_G, COUNT(preparse_schema_G)), "preparse_schema_G must be sorted by code.");
+  static_assert(schema_sorted(preparse_schema_M, COUNT(preparse_schema_M)), "preparse_schema_M must be sorted by code.");
+
+  // Find the parameters a command takes. Return false if it can't be pre-parsed.
+  static bool schema_params(const gcode_schema_t *table, uint8_t n, const uint16_t code, uint32_t &params) {
+    while (n) {
+      const uint8_t half = n >> 1;
+      const gcode_schema_t * const sc = table + half;
+      const uint16_t c = pgm_read_word(&sc->codenum);
+      if (c == code) {
+        memcpy_P(&params, &sc->params, sizeof(params));
+        return true;
+      }
+      if (c < code) { table = sc + 1; n -= half + 1; }
+      else n = half;
+    }
+    return false;
+  }
+
+  /**
+   * Parse a command line into compact form as it's queued. Anything unusual
+   * (a command or parameter not in the schema, a sub-code, a parameter with
+   * no value, a repeated letter, too many parameters) returns false so the
+   * line is kept as text instead.
+   */
+  bool GCodeParser::preparse(const char *p, parsed_gcode_t &out) {
+
+    auto uppercase = [](char c) {
+      if (TERN0(GCODE_CASE_INSENSITIVE, WITHIN(c, 'a', 'z')))
+        c += 'A' - 'a';
+      return c;
+    };
+
+    while (*p == ' ') ++p;
+
+    // Skip N[-0-9] if included in the command line
+    if (uppercase(*p) == 'N' && NUMERIC_SIGNED(p[1])) {
+      p += 2;
+      while (NUMERIC(*p)) ++p;
+      while (*p == ' ') ++p;
+    }
+
+    const char letter = uppercase(*p++);
+    if (letter != 'G' && letter != 'M') return false;
+    while (*p == ' ') ++p;
+    if (!NUMERIC(*p)) return false;
+
+    uint16_t code = 0;
+    do { code = code * 10 + *p++ - '0'; } while (NUMERIC(*p) && code < 1000);
+    if (NUMERIC(*p) || *p == '.') return false;   // Too long, or has a sub-code
+
+    // Look up the parameters this command takes
+    uint32_t legal;
+    const bool known = letter == 'G'
+      ? schema_params(preparse_schema_G, COUNT(preparse_schema_G), code, legal)
+      : schema_params(preparse_schema_M, COUNT(preparse_schema_M), code, legal);
+    if (!known) return false;
+
+    out.nul = '\0';
+    out.letter = letter;
+    out.codenum = code;
+    out.codebits = 0;
+
+    uint8_t count = 0;
+    for (;;) {
+      while (*p == ' ') ++p;
+      if (*p == '\0' || *p == '*') break;          // End of the line or checksum
+
+      const char param = uppercase(*p++);
+      if (!WITHIN(param, 'A', 'Z')) return false;
+      const uint8_t ind = LETTER_BIT(param);
+      if (!TEST32(legal, ind) || TEST32(out.codebits, ind) || count >= PARSED_GCODE_PARAMS) return false;
+
+      while (*p == ' ') ++p;
+      if (!valid_float(p)) return false;            // A flag or a string
+
+      // Values are kept in letter order, so make room for this one
+      uint8_t n = 0;
+      LOOP_L_N(i, ind) if (TEST32(out.codebits, i)) n++;
+      for (uint8_t i = count; i > n; --i) out.value[i] = out.value[i - 1];
+
+      out.value[n] = parse_float(p, &p);
+      if (DECIMAL_SIGNED(*p)) return false;         // Something like "1.2.3"
+
+      SBI32(out.codebits, ind);
+      count++;
+    }
+
+    return true;
+  }
+
+#endif
+
 /**
  * Populate the command line state (command_letter, codenum, subcode, and string_arg)
  * by parsing a single line of GCode. 58 bytes of SRAM are used to speed up seen/value.
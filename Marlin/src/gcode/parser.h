@@ -42,6 +42,30 @@
   typedef enum : uint8_t { LINEARUNIT_MM, LINEARUNIT_INCH } LinearUnit;
 #endif
 
+#if HAS_PARSED_GCODE
+
+  // Most parameters in a parsed command. A binary G2/G3 frame has 9.
+  #if ENABLED(PREPARSED_GCODE_QUEUE) && (DISABLED(BINARY_GCODE) || PREPARSED_GCODE_PARAMS > 9)
+    #define PARSED_GCODE_PARAMS PREPARSED_GCODE_PARAMS
+  #else
+    #define PARSED_GCODE_PARAMS 9
+  #endif
+
+  /**
+   * A command that arrives already parsed, e.g., as a binary G-code frame,
+   * or one parsed as it was queued. It's kept in a CommandLine buffer. The
+   * leading nul marks it as parsed, and makes the buffer read as an empty
+   * string to code expecting text.
+   */
+  typedef struct {
+    char     nul, letter;                 // '\0' and G, M, or T
+    uint16_t codenum;                     // 123
+    uint32_t codebits;                    // Parameter letters included
+    float    value[PARSED_GCODE_PARAMS];  // Parameter values in letter order
+  } parsed_gcode_t;
+
+#endif
+
 /**
  * GCode parser
  *
@@ -66,6 +90,10 @@ private:
     static char *command_args;      // Args start here, for slow scan
   #endif
 
+  #if HAS_PARSED_GCODE
+    static const float *parsed_values;  // Values of a pre-parsed command, or nullptr
+  #endif
+
 public:
 
   // Global states for GCode-level units features
@@ -147,6 +175,12 @@ public:
       if (ind >= COUNT(param)) return false; // Only A-Z
       const bool b = TEST32(codebits, ind);
       if (b) {
+        #if HAS_PARSED_GCODE
+          if (parsed_values) {
+            value_ptr = (char*)&parsed_values[param[ind]];
+            return b;
+          }
+        #endif
         if (param[ind]) {
           char * const ptr = command_ptr + param[ind];
           value_ptr = valid_number(ptr) ? ptr : nullptr;
@@ -239,6 +273,20 @@ public:
   // This uses 54 bytes of SRAM to speed up seen/value
   static void parse(char * p);
 
+  #if HAS_PARSED_GCODE
+    // Populate all fields from a pre-parsed command
+    static void load(const parsed_gcode_t &cmd);
+    FORCE_INLINE static float parsed_value() { return value_ptr ? *(float*)value_ptr : 0; }
+
+    // Was the current command loaded pre-parsed? Then command_ptr points to its leading nul.
+    FORCE_INLINE static bool is_loaded() { return parsed_values != nullptr; }
+  #endif
+
+  #if ENABLED(PREPARSED_GCODE_QUEUE)
+    // Parse a simple command line into compact form. Return false to keep it as text.
+    static bool preparse(const char *p, parsed_gcode_t &out);
+  #endif
+
   #if ENABLED(CNC_COORDINATE_SYSTEMS)
     // Parse the next parameter as a new command
     static bool chain();
@@ -256,29 +304,30 @@ public:
   // The value as a string
   static inline char* value_string() { return value_ptr; }
 
-  // Float removes 'E' to prevent scientific notation interpretation
+  // Parse a plain decimal number, stopping at anything else. So "1E5" is 1, not scientific notation.
+  static float parse_float(const char *p, const char **end=nullptr);
+
+  // The value as a float
   static inline float value_float() {
-    if (value_ptr) {
-      char *e = value_ptr;
-      for (;;) {
-        const char c = *e;
-        if (c == '\0' || c == ' ') break;
-        if (c == 'E' || c == 'e') {
-          *e = '\0';
-          const float ret = strtof(value_ptr, nullptr);
-          *e = c;
-          return ret;
-        }
-        ++e;
-      }
-      return strtof(value_ptr, nullptr);
-    }
-    return 0;
+    #if HAS_PARSED_GCODE
+      if (parsed_values) return parsed_value();
+    #endif
+    return value_ptr ? parse_float(value_ptr) : 0;
   }
 
   // Code value as a long or ulong
-  static inline int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
-  static inline uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  static inline int32_t value_long() {
+    #if HAS_PARSED_GCODE
+      if (parsed_values) return LROUND(parsed_value());
+    #endif
+    return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L;
+  }
+  static inline uint32_t value_ulong() {
+    #if HAS_PARSED_GCODE
+      if (parsed_values) return LROUND(parsed_value());
+    #endif
+    return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL;
+  }
 
   // Code value for use as time
   static inline millis_t value_millis() { return value_ulong(); }
@@ -49,6 +49,10 @@ GCodeQueue queue;
   #include "../feature/binary_stream.h"
 #endif
 
+#if ENABLED(BINARY_GCODE)
+  #include "../feature/binary_gcode.h"
+#endif
+
 #if ENABLED(POWER_LOSS_RECOVERY)
   #include "../feature/powerloss.h"
 #endif
@@ -105,7 +109,12 @@ bool GCodeQueue::RingBuffer::enqueue(const char *cmd, bool skip_ok/*=true*/
   #endif
 ) {
   if (*cmd == ';' || length >= BUFSIZE) return false;
-  strcpy(commands[index_w].buffer, cmd);
+  #if ENABLED(PREPARSED_GCODE_QUEUE)
+    if (!store(cmd)) return false;
+  #else
+    strcpy(commands[index_w].buffer, cmd);
+    TERN_(BINARY_GCODE, commands[index_w].pre_parsed = false);
+  #endif
   commit_command(skip_ok
     #if HAS_MULTI_SERIAL
       , serial_ind
@@ -114,6 +123,90 @@ bool GCodeQueue::RingBuffer::enqueue(const char *cmd, bool skip_ok/*=true*/
   return true;
 }
 
+#if ENABLED(PREPARSED_GCODE_QUEUE)
+
+  #if ENABLED(SDSUPPORT)
+    // Matches "M28" and "M928" that start writing to SD, but not "M280", etc.
+    static bool is_M28(const char * const cmd) {
+      const char * const m28 = strstr_P(cmd, PSTR("M28"));
+      if (m28 && !NUMERIC(m28[3])) return true;
+      const char * const m928 = strstr_P(cmd, PSTR("M928"));
+      return m928 && !NUMERIC(m928[4]);
+    }
+  #endif
+
+  /**
+   * Pre-parse a command into the next queue slot. If it can't be pre-parsed,
+   * copy it to the text pool (unless it's already there) and mark the slot.
+   * Commands are kept as text while writing to SD, behind a queued M28 or M928
+   * (since they may be written to SD), or while echoing commands.
+   * Return false if the text pool is full.
+   */
+  bool GCodeQueue::RingBuffer::store(const char *cmd) {
+    CommandLine &command = commands[index_w];
+    if (!TERN0(SDSUPPORT, (card.flag.saving || saves_queued)) && !DEBUGGING(ECHO) && parser.preparse(cmd, command.parsed))
+      return (command.pre_parsed = true);
+    if (text_length >= PREPARSED_TEXT_BUFSIZE) return false;
+    if (cmd != text[text_w]) strcpy(text[text_w], cmd);
+    TERN_(SDSUPPORT, if (is_M28(cmd)) saves_queued++);
+    command.pre_parsed = false;
+    if (++text_w >= PREPARSED_TEXT_BUFSIZE) text_w = 0;
+    text_length++;
+    return true;
+  }
+
+#endif
+
+#if ENABLED(SD_PRINT_INDEX)
+
+  /**
+   * Drop the commands behind the one being run that don't get an "ok", such as
+   * lines read ahead from SD, before the SD position changes. Commands from the
+   * host are kept in order, so the host still gets an "ok" for each of them.
+   */
+  void GCodeQueue::RingBuffer::drop_unacked() {
+    if (length < 2) return;
+
+    uint8_t r = index_r, w = index_r, kept = 1;
+    #if ENABLED(PREPARSED_GCODE_QUEUE)
+      auto next_text = [](uint8_t &t) { if (++t >= PREPARSED_TEXT_BUFSIZE) t = 0; };
+      uint8_t tr = text_r, tw = text_r, text_kept = 0;
+      if (!commands[r].is_parsed()) { next_text(tr); next_text(tw); text_kept++; }
+    #endif
+    advance_pos(r, 0);
+    advance_pos(w, 0);
+
+    for (uint8_t n = length - 1; n--; advance_pos(r, 0)) {
+      const bool keep = !commands[r].skip_ok;
+      #if ENABLED(PREPARSED_GCODE_QUEUE)
+        if (!commands[r].is_parsed()) {
+          if (keep) {
+            if (tw != tr) strcpy(text[tw], text[tr]);
+            next_text(tw);
+            text_kept++;
+          }
+          else if (saves_queued && is_M28(text[tr]))
+            saves_queued--;
+          next_text(tr);
+        }
+      #endif
+      if (keep) {
+        if (w != r) commands[w] = commands[r];
+        advance_pos(w, 0);
+        kept++;
+      }
+    }
+
+    index_w = w;
+    length = kept;
+    #if ENABLED(PREPARSED_GCODE_QUEUE)
+      text_w = tw;
+      text_length = text_kept;
+    #endif
+  }
+
+#endif // SD_PRINT_INDEX
+
 /**
  * Enqueue with Serial Echo
  * Return true if the command was consumed
@@ -231,6 +324,10 @@ void GCodeQueue::enqueue_now_P(PGM_P const pgcode) {
  *   N<int>  Line number of the command, if any
  *   P<int>  Planner space remaining
  *   B<int>  Block queue space remaining
+ *
+ * If flow credits are enabled (M577 S1) also include:
+ *   C<int>  Bytes read from the port so far, modulo 65536
+ *   B<int>  Block queue space remaining, if ADVANCED_OK didn't report it
  */
 void GCodeQueue::RingBuffer::ok_to_send() {
   #if NO_TIMEOUTS > 0
@@ -246,7 +343,7 @@ void GCodeQueue::RingBuffer::ok_to_send() {
   if (command.skip_ok) return;
   SERIAL_ECHOPGM(STR_OK);
   #if ENABLED(ADVANCED_OK)
-    char* p = command.buffer;
+    char* p = peek_next_command_string();
     if (*p == 'N') {
       SERIAL_CHAR(' ', *p++);
       while (NUMERIC_SIGNED(*p))
@@ -255,6 +352,15 @@ void GCodeQueue::RingBuffer::ok_to_send() {
     SERIAL_ECHOPAIR_P(SP_P_STR, planner.moves_free(),
                       SP_B_STR, BUFSIZE - length);
   #endif
+  #if ENABLED(SERIAL_FLOW_CREDITS)
+    const SerialState &serial = serial_state[TERN0(HAS_MULTI_SERIAL, serial_ind.index)];
+    if (serial.credits) {
+      SERIAL_ECHOPAIR(" C", serial.bytes_read);
+      #if DISABLED(ADVANCED_OK)
+        SERIAL_ECHOPAIR_P(SP_B_STR, BUFSIZE - length);
+      #endif
+    }
+  #endif
   SERIAL_EOL();
 }
 
@@ -270,9 +376,10 @@ void GCodeQueue::flush_and_request_resend(const serial_index_t serial_ind) {
   SERIAL_FLUSH();
   SERIAL_ECHOLNPAIR(STR_RESEND, serial_state[serial_ind.index].last_N + 1);
   SERIAL_ECHOLNPGM(STR_OK);
+  TERN_(HAS_SERIAL_RESEND_WINDOW, serial_state[serial_ind.index].resend_pending = true);
 }
 
-static bool serial_data_available(serial_index_t index) {
+static int serial_available(serial_index_t index) {
   const int a = SERIAL_IMPL.available(index);
   #if BOTH(RX_BUFFER_MONITOR, RX_BUFFER_SIZE)
     if (a > RX_BUFFER_SIZE - 2) {
@@ -280,7 +387,18 @@ static bool serial_data_available(serial_index_t index) {
       SERIAL_ERROR_MSG("RX BUF overflow, increase RX_BUFFER_SIZE: ", a);
     }
   #endif
-  return a > 0;
+  return a;
+}
+
+static bool serial_data_available(serial_index_t index) {
+  #if SERIAL_READ_CHUNK
+    // Check the RX buffer once per span. Bytes read in place still count
+    // as available until they're freed, so the monitor sees them too.
+    const GCodeQueue::SerialState &ss = GCodeQueue::serial_state[index.index];
+    return ss.rx_index < ss.rx_length || serial_available(index) > ss.rx_index;
+  #else
+    return serial_available(index) > 0;
+  #endif
 }
 
 #if NO_TIMEOUTS > 0
@@ -295,13 +413,45 @@ static bool serial_data_available(serial_index_t index) {
 
 inline int read_serial(const serial_index_t index) { return SERIAL_IMPL.read(index); }
 
+#if SERIAL_READ_CHUNK
+  // Free the bytes of the port's RX buffer read so far in place
+  static void release_serial(const serial_index_t index) {
+    GCodeQueue::SerialState &ss = GCodeQueue::serial_state[index.index];
+    if (ss.rx_index) SERIAL_IMPL.rxRelease(index, ss.rx_index);
+    ss.rx_index = ss.rx_length = 0;
+  }
+
+  static void release_serial_all() { LOOP_L_N(p, NUM_SERIAL) release_serial(p); }
+
+  // Get the next char in place from the port's RX buffer, freeing up to SERIAL_READ_CHUNK bytes at once.
+  // If the port doesn't allow reading in place, read a char at a time.
+  inline int read_serial_chunked(const serial_index_t index) {
+    GCodeQueue::SerialState &ss = GCodeQueue::serial_state[index.index];
+    if (ss.rx_index >= ss.rx_length) {
+      release_serial(index);
+      ss.rx_length = SERIAL_IMPL.rxSpan(index, &ss.rx_span, SERIAL_READ_CHUNK);
+      if (!ss.rx_length) return read_serial(index);
+    }
+    return ss.rx_span[ss.rx_index++];
+  }
+#else
+  #define read_serial_chunked read_serial
+  #define release_serial_all() NOOP
+#endif
+
 void GCodeQueue::gcode_line_error(PGM_P const err, const serial_index_t serial_ind) {
   PORT_REDIRECT(SERIAL_PORTMASK(serial_ind)); // Reply to the serial port that sent the command
   SERIAL_ERROR_START();
   SERIAL_ECHOLNPAIR_P(err, serial_state[serial_ind.index].last_N);
-  while (read_serial(serial_ind) != -1) { /* nada */ } // Clear out the RX buffer. Why don't use flush here ?
+  #if SERIAL_READ_CHUNK
+    release_serial(serial_ind);
+  #endif
+  while (read_serial(serial_ind) != -1) { // Clear out the RX buffer. Why don't use flush here ?
+    TERN_(SERIAL_FLOW_CREDITS, serial_state[serial_ind.index].bytes_read++); // Discarded bytes are used credits too
+  }
   flush_and_request_resend(serial_ind);
   serial_state[serial_ind.index].count = 0;
+  serial_state[serial_ind.index].start_line();
 }
 
 FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", but not "M290", etc
@@ -315,7 +465,11 @@ FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", b
 #define PS_PAREN  3
 #define PS_ESC    4
 
-inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+/**
+ * Add a character to the line, skipping comments. With 'ss' also
+ * update the line checksum of a serial port.
+ */
+inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind, GCodeQueue::SerialState * const ss=nullptr) {
 
   if (sis == PS_EOL) return;    // EOL comment or overflow
 
@@ -358,9 +512,33 @@ inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD
 
   // Backspace erases previous characters
   if (c == 0x08) {
-    if (ind) buff[--ind] = '\0';
+    if (ind) {
+      --ind;
+      if (ss) {
+        if (ind < ss->lead) ss->lead--;
+        else {
+          ss->checksum ^= buff[ind];
+          if (ind + 1 == ss->star) {  // Erased the last '*' so look for one before it
+            ss->star = 0;
+            uint8_t sum = ss->checksum;
+            for (int i = ind; i-- > ss->lead;) {
+              sum ^= buff[i];
+              if (buff[i] == '*') { ss->star = i + 1; ss->star_checksum = sum; break; }
+            }
+          }
+        }
+      }
+      buff[ind] = '\0';
+    }
   }
   else {
+    if (ss) {
+      if (ind == ss->lead && c == ' ') ss->lead++;
+      else {
+        if (c == '*') { ss->star_checksum = ss->checksum; ss->star = ind + 1; }
+        ss->checksum ^= c;
+      }
+    }
     buff[ind++] = c;
     if (ind >= MAX_CMD_SIZE - 1)
       sis = PS_EOL;             // Skip the rest on overflow
@@ -417,7 +595,7 @@ void GCodeQueue::get_serial_commands() {
 
     LOOP_L_N(p, NUM_SERIAL) {
       // Check if the queue is full and exit if it is.
-      if (ring_buffer.full()) return;
+      if (ring_buffer.full()) { release_serial_all(); return; }
 
       // No data for this port ? Skip it
       if (!serial_data_available(p)) continue;
@@ -425,7 +603,7 @@ void GCodeQueue::get_serial_commands() {
       // Ok, we have some data to process, let's make progress here
       hadData = true;
 
-      const int c = read_serial(p);
+      const int c = read_serial_chunked(p);
       if (c < 0) {
         // This should never happen, let's log it
         PORT_REDIRECT(SERIAL_PORTMASK(p));     // Reply to the serial port that sent the command
@@ -439,8 +617,41 @@ void GCodeQueue::get_serial_commands() {
       const char serial_char = (char)c;
       SerialState &serial = serial_state[p];
 
+      TERN_(SERIAL_FLOW_CREDITS, serial.bytes_read++);
+
+      #if ENABLED(BINARY_GCODE)
+        // Binary frames go into the queue pre-parsed
+        const BinaryGcode::Result bg = binaryGcode[p].receive(uint8_t(c), serial.count == 0);
+        if (bg == BinaryGcode::BG_ERROR) {
+          // In case of error on a serial port, don't prevent other serial port from making progress
+          gcode_line_error(PSTR(STR_ERR_CHECKSUM_MISMATCH), p);
+          break;
+        }
+        if (bg == BinaryGcode::BG_FRAME) {
+          CommandLine &command = ring_buffer.commands[ring_buffer.index_w];
+          binaryGcode[p].decode(command.parsed);
+          command.pre_parsed = true;
+          serial.last_N++;
+          #if NO_TIMEOUTS > 0
+            last_command_time = ms;
+          #endif
+          ring_buffer.commit_command(false
+            #if HAS_MULTI_SERIAL
+              , p
+            #endif
+          );
+          continue;
+        }
+        if (bg == BinaryGcode::BG_CONSUMED) continue;
+      #endif
+
       if (ISEOL(serial_char)) {
 
+        // Keep the checksum of the completed line
+        const int star = serial.star;
+        const uint8_t checksum = serial.star_checksum;
+        serial.start_line();
+
         // Reset our state, continue if the line was empty
         if (process_line_done(serial.input_state, serial.line_buffer, serial.count))
           continue;
@@ -461,17 +672,18 @@ void GCodeQueue::get_serial_commands() {
 
           const long gcode_N = strtol(npos + 1, nullptr, 10);
 
-          if (gcode_N != serial.last_N + 1 && !M110) {
-            // In case of error on a serial port, don't prevent other serial port from making progress
-            gcode_line_error(PSTR(STR_ERR_LINE_NO), p);
-            break;
-          }
+          // With a resend window the line number is checked after the checksum,
+          // so a corrupted N is never taken for a line to skip
+          #if !HAS_SERIAL_RESEND_WINDOW
+            if (gcode_N != serial.last_N + 1 && !M110) {
+              // In case of error on a serial port, don't prevent other serial port from making progress
+              gcode_line_error(PSTR(STR_ERR_LINE_NO), p);
+              break;
+            }
+          #endif
 
-          char *apos = strrchr(command, '*');
-          if (apos) {
-            uint8_t checksum = 0, count = uint8_t(apos - command);
-            while (count) checksum ^= command[--count];
-            if (strtol(apos + 1, nullptr, 10) != checksum) {
+          if (star) {
+            if (strtol(&serial.line_buffer[star], nullptr, 10) != checksum) {
               // In case of error on a serial port, don't prevent other serial port from making progress
               gcode_line_error(PSTR(STR_ERR_CHECKSUM_MISMATCH), p);
               break;
@@ -483,7 +695,30 @@ void GCodeQueue::get_serial_commands() {
             break;
           }
 
+          #if HAS_SERIAL_RESEND_WINDOW
+            if (!M110 && gcode_N != serial.last_N + 1) {
+              // Skip a line that was already accepted
+              if (gcode_N <= serial.last_N && gcode_N > _MAX(serial.base_N, serial.last_N - (SERIAL_RESEND_WINDOW))) {
+                PORT_REDIRECT(SERIAL_PORTMASK(p));
+                SERIAL_ECHOLNPGM(STR_OK);
+                continue;
+              }
+              // Skip a line sent before the host saw "Resend:" and ask for the expected line again
+              if (serial.resend_pending && gcode_N > serial.last_N && gcode_N <= serial.last_N + (SERIAL_RESEND_WINDOW)) {
+                flush_and_request_resend(p);
+                continue;
+              }
+              // In case of error on a serial port, don't prevent other serial port from making progress
+              gcode_line_error(PSTR(STR_ERR_LINE_NO), p);
+              break;
+            }
+          #endif
+
           serial.last_N = gcode_N;
+          #if HAS_SERIAL_RESEND_WINDOW
+            if (M110) serial.base_N = gcode_N;
+            serial.resend_pending = false;
+          #endif
         }
         #if ENABLED(SDSUPPORT)
           // Pronterface "M29" and "M29 " has no line number
@@ -537,10 +772,12 @@ void GCodeQueue::get_serial_commands() {
         );
       }
       else
-        process_stream_char(serial_char, serial.input_state, serial.line_buffer, serial.count);
+        process_stream_char(serial_char, serial.input_state, serial.line_buffer, serial.count, &serial);
 
     } // NUM_SERIAL loop
   } // queue has space, serial has data
+
+  release_serial_all();
 }
 
 #if ENABLED(SDSUPPORT)
@@ -550,6 +787,10 @@ void GCodeQueue::get_serial_commands() {
    * or until the end of the file is reached. Because this method
    * always receives complete command-lines, they can go directly
    * into the main command queue.
+   *
+   * Lines are scanned in place from the card's current block.
+   * Leading spaces and comments are dropped in the same pass,
+   * and the card index is advanced once per line or block.
    */
   inline void GCodeQueue::get_sdcard_commands() {
     static uint8_t sd_input_state = PS_NORMAL;
@@ -558,29 +799,45 @@ void GCodeQueue::get_serial_commands() {
 
     int sd_count = 0;
     while (!ring_buffer.full() && !card.eof()) {
-      const int16_t n = card.get();
-      const bool card_eof = card.eof();
-      if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
+      const char *sd_block;
+      const uint16_t avail = card.peek(sd_block);
+      if (!avail) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
+
+      char (&line)[MAX_CMD_SIZE] = ring_buffer.next_line_buffer();
+
+      uint16_t i = 0;
+      for (; i < avail; ++i) {
+        const char sd_char = sd_block[i];
+        if (ISEOL(sd_char)) break;
+        if (sd_input_state == PS_EOL) continue;   // Skip comment or overflow
+        if (sd_char == ' ' && !sd_count && sd_input_state == PS_NORMAL) continue; // Skip leading space
+        process_stream_char(sd_char, sd_input_state, line, sd_count);
+      }
 
-      CommandLine &command = ring_buffer.commands[ring_buffer.index_w];
-      const char sd_char = (char)n;
-      const bool is_eol = ISEOL(sd_char);
-      if (is_eol || card_eof) {
+      const bool is_eol = i < avail;
+      card.advance(i + is_eol);                         // Consume the scanned bytes and EOL
+      if (is_eol || card.eof()) {
 
         // Reset stream state, terminate the buffer, and commit a non-empty command
-        if (!is_eol && sd_count) ++sd_count;          // End of file with no newline
-        if (!process_line_done(sd_input_state, command.buffer, sd_count)) {
+        if (!process_line_done(sd_input_state, line, sd_count)) {
 
           // M808 L saves the sdpos of the next line. M808 loops to a new sdpos.
-          TERN_(GCODE_REPEAT_MARKERS, repeat.early_parse_M808(command.buffer));
+          TERN_(GCODE_REPEAT_MARKERS, repeat.early_parse_M808(line));
 
           #if DISABLED(PARK_HEAD_ON_PAUSE)
             // When M25 is non-blocking it can still suspend SD commands
             // Otherwise the M125 handler needs to know SD printing is active
-            if (command.buffer[0] == 'M' && command.buffer[1] == '2' && command.buffer[2] == '5' && !NUMERIC(command.buffer[3]))
+            if (line[0] == 'M' && line[1] == '2' && line[2] == '5' && !NUMERIC(line[3]))
               card.pauseSDPrint();
           #endif
 
+          // Pre-parse the line, or keep it in the text pool. There's room, since the queue isn't full.
+          #if ENABLED(PREPARSED_GCODE_QUEUE)
+            ring_buffer.store(line);
+          #elif ENABLED(BINARY_GCODE)
+            ring_buffer.commands[ring_buffer.index_w].pre_parsed = false;
+          #endif
+
           // Put the new command into the buffer (no "ok" sent)
           ring_buffer.commit_command(true);
 
@@ -590,8 +847,6 @@ void GCodeQueue::get_serial_commands() {
 
         if (card.eof()) card.fileHasFinished();         // Handle end of file reached
       }
-      else
-        process_stream_char(sd_char, sd_input_state, command.buffer, sd_count);
     }
   }
 
@@ -630,8 +885,17 @@ void GCodeQueue::advance() {
   // Return if the G-code buffer is empty
   if (ring_buffer.empty()) return;
 
+  // A text line stays in the pool until the command is done
+  TERN_(PREPARSED_GCODE_QUEUE, const bool is_text = !ring_buffer.peek_next_command().is_parsed());
+
   #if ENABLED(SDSUPPORT)
 
+    #if ENABLED(PREPARSED_GCODE_QUEUE)
+      // Lines queued after this M28 / M928 can be pre-parsed once it's done
+      if (is_text && ring_buffer.saves_queued && is_M28(ring_buffer.peek_next_command_string()))
+        ring_buffer.saves_queued--;
+    #endif
+
     if (card.flag.saving) {
       char * const cmd = ring_buffer.peek_next_command_string();
       if (is_M29(cmd)) {
@@ -669,5 +933,6 @@ void GCodeQueue::advance() {
   #endif // SDSUPPORT
 
   // The queue may be reset by a command handler or by code invoked by idle() within a handler
+  TERN_(PREPARSED_GCODE_QUEUE, if (is_text) ring_buffer.release_text());
   ring_buffer.advance_pos(ring_buffer.index_r, -1);
 }
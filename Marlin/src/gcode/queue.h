@@ -28,6 +28,10 @@
 
 #include "../inc/MarlinConfig.h"
 
+#if HAS_PARSED_GCODE
+  #include "parser.h"
+#endif
+
 class GCodeQueue {
 public:
   /**
@@ -43,6 +47,38 @@ public:
     int count;                      //!< Number of characters read in the current line of serial input
     char line_buffer[MAX_CMD_SIZE]; //!< The current line accumulator
     uint8_t input_state;            //!< The input state
+
+    /**
+     * The line checksum is the XOR of the line, minus leading spaces, up to
+     * the last '*'. It's updated as characters arrive.
+     */
+    uint8_t checksum,               //!< XOR of the line so far
+            star_checksum;          //!< XOR of the line up to the last '*'
+    int lead,                       //!< Number of leading spaces
+        star;                       //!< Position after the last '*', or 0 if none
+
+    inline void start_line() { checksum = star_checksum = 0; lead = star = 0; }
+
+    #if SERIAL_READ_CHUNK
+      const uint8_t *rx_span;       //!< Bytes being read in place from the RX buffer
+      uint8_t rx_index,             //!< Next byte to process in rx_span, or the number to free
+              rx_length;            //!< Number of bytes in rx_span
+    #endif
+
+    #if HAS_SERIAL_RESEND_WINDOW
+      /**
+       * Lines from base_N+1 to last_N were accepted. The last SERIAL_RESEND_WINDOW
+       * of them are skipped with "ok" if the host sends them again. Lines sent
+       * before the host saw a "Resend:" are also skipped until it's answered.
+       */
+      long base_N;                  //!< Line number set by M110
+      bool resend_pending;          //!< A "Resend:" hasn't been answered yet
+    #endif
+
+    #if ENABLED(SERIAL_FLOW_CREDITS)
+      bool credits;                 //!< Report the bytes read with each "ok" (M577)
+      uint16_t bytes_read;          //!< Bytes read from the port, rolling over
+    #endif
   };
 
   static SerialState serial_state[NUM_SERIAL]; //!< Serial states for each serial port
@@ -55,9 +91,25 @@ public:
    * (immediate, serial, sd card) and they are processed sequentially by
    * the main loop. The gcode.process_next_command method parses the next
    * command and hands off execution to individual handler functions.
+   *
+   * With PREPARSED_GCODE_QUEUE the commands are parsed as they're queued
+   * and only lines that can't be pre-parsed take a slot in the text pool.
    */
   struct CommandLine {
-    char buffer[MAX_CMD_SIZE];      //!< The command buffer
+    #if ENABLED(PREPARSED_GCODE_QUEUE)
+      parsed_gcode_t parsed;        //!< The pre-parsed command, unless it's in the text pool
+    #else
+      union {
+        char buffer[MAX_CMD_SIZE];  //!< The command buffer
+        #if ENABLED(BINARY_GCODE)
+          parsed_gcode_t parsed;    //!< A pre-parsed command
+        #endif
+      };
+    #endif
+    #if HAS_PARSED_GCODE
+      bool pre_parsed;              //!< The command is in 'parsed', not text
+    #endif
+    inline bool is_parsed() const { return TERN0(HAS_PARSED_GCODE, pre_parsed); }
     bool skip_ok;                   //!< Skip sending ok when command is processed?
     #if ENABLED(HAS_MULTI_SERIAL)
       serial_index_t port;          //!< Serial port the command was received on
@@ -73,9 +125,35 @@ public:
             index_w;                //!< Ring buffer's write position
     CommandLine commands[BUFSIZE];  //!< The ring buffer of commands
 
+    #if ENABLED(PREPARSED_GCODE_QUEUE)
+      uint8_t text_length,          //!< Number of text lines in the pool
+              text_r,               //!< Text pool read position
+              text_w;               //!< Text pool write position
+      char text[PREPARSED_TEXT_BUFSIZE][MAX_CMD_SIZE]; //!< Lines that couldn't be pre-parsed
+      #if ENABLED(SDSUPPORT)
+        uint8_t saves_queued;       //!< Number of M28 / M928 in the queue
+      #endif
+
+      // Pre-parse a command into commands[index_w], or add it to the text pool
+      bool store(const char *cmd);
+
+      // Free the text line of a command that was run
+      void release_text() {
+        if (!text_length) return;
+        if (++text_r >= PREPARSED_TEXT_BUFSIZE) text_r = 0;
+        text_length--;
+      }
+    #endif
+
     inline serial_index_t command_port() const { return TERN0(HAS_MULTI_SERIAL, commands[index_r].port); }
 
-    inline void clear() { length = index_r = index_w = 0; }
+    inline void clear() {
+      length = index_r = index_w = 0;
+      #if ENABLED(PREPARSED_GCODE_QUEUE)
+        text_length = text_r = text_w = 0;
+        TERN_(SDSUPPORT, saves_queued = 0);
+      #endif
+    }
 
     void advance_pos(uint8_t &p, const int inc) { if (++p >= BUFSIZE) p = 0; length += inc; }
 
@@ -93,7 +171,15 @@ public:
 
     void ok_to_send();
 
-    inline bool full(uint8_t cmdCount=1) const { return length > (BUFSIZE - cmdCount); }
+    #if ENABLED(SD_PRINT_INDEX)
+      // Drop commands behind the current one that don't get an "ok", e.g., lines read from SD
+      void drop_unacked();
+    #endif
+
+    // With PREPARSED_GCODE_QUEUE a text slot is needed in case the next line can't be pre-parsed
+    inline bool full(uint8_t cmdCount=1) const {
+      return length > (BUFSIZE - cmdCount) || TERN0(PREPARSED_GCODE_QUEUE, text_length >= PREPARSED_TEXT_BUFSIZE);
+    }
 
     inline bool occupied() const { return length != 0; }
 
@@ -101,7 +187,17 @@ public:
 
     inline CommandLine& peek_next_command() { return commands[index_r]; }
 
-    inline char* peek_next_command_string() { return peek_next_command().buffer; }
+    inline char* peek_next_command_string() {
+      #if ENABLED(PREPARSED_GCODE_QUEUE)
+        CommandLine &command = peek_next_command();
+        return command.is_parsed() ? &command.parsed.nul : text[text_r];
+      #else
+        return peek_next_command().buffer;
+      #endif
+    }
+
+    // The buffer where the next line of text is collected
+    inline char (&next_line_buffer())[MAX_CMD_SIZE] { return TERN(PREPARSED_GCODE_QUEUE, text[text_w], commands[index_w].buffer); }
   };
 
   /**
@@ -199,7 +295,11 @@ public:
   /**
    * (Re)Set the current line number for the last received command
    */
-  static inline void set_current_line_number(long n) { serial_state[ring_buffer.command_port().index].last_N = n; }
+  static inline void set_current_line_number(long n) {
+    SerialState &serial = serial_state[ring_buffer.command_port().index];
+    serial.last_N = n;
+    TERN_(HAS_SERIAL_RESEND_WINDOW, serial.base_N = n);
+  }
 
 private:
 
@@ -29,12 +29,29 @@
 
 /**
  * M20: List SD card to serial output
+ *
+ * With M20_PAGED_LISTING:
+ *   S<index> - Start listing at this file
+ *   C<count> - List up to this many files. If more remain, the
+ *              index to continue from is reported after the list.
+ *   T        - Include the modified date and time as 0xDDDDTTTT (FAT format)
+ *   L        - Include the long filename, if any (LONG_FILENAME_HOST_SUPPORT)
  */
 void GcodeSuite::M20() {
   if (card.flag.mounted) {
     SERIAL_ECHOLNPGM(STR_BEGIN_FILE_LIST);
-    card.ls();
-    SERIAL_ECHOLNPGM(STR_END_FILE_LIST);
+    #if ENABLED(M20_PAGED_LISTING)
+      const uint16_t next = card.ls(
+          (parser.boolval('T') ? card.LS_TIMESTAMP : 0)
+        | (TERN0(LONG_FILENAME_HOST_SUPPORT, parser.boolval('L')) ? card.LS_LONG_FILENAME : 0),
+        parser.ushortval('S'), parser.ushortval('C')
+      );
+      SERIAL_ECHOLNPGM(STR_END_FILE_LIST);
+      if (next) SERIAL_ECHOLNPAIR("Next file list S", next);
+    #else
+      card.ls();
+      SERIAL_ECHOLNPGM(STR_END_FILE_LIST);
+    #endif
   }
   else
     SERIAL_ECHO_MSG(STR_NO_MEDIA);
@@ -26,12 +26,31 @@
 
 #include "../gcode.h"
 #include "../../sd/cardreader.h"
+#include "../../module/motion.h"
 
 /**
  * M26: Set SD Card file index
+ *
+ *  S<pos>   - Set the position in the file
+ *  L<layer> - Set the position to the start of a layer (zero-based). Wait for the
+ *             temperatures it expects, move to where it starts, and restore the
+ *             fan speed, feedrate, and E position. Requires SD_PRINT_INDEX, a
+ *             completed index for the file, homed XYZ, and a paused or unstarted print.
  */
 void GcodeSuite::M26() {
-  if (card.isMounted() && parser.seenval('S'))
+  if (!card.isMounted()) return;
+
+  #if ENABLED(SD_PRINT_INDEX)
+    if (parser.seenval('L')) {
+      if (card.isPrinting())
+        SERIAL_ECHO_MSG("Pause the print first.");
+      else if (!homing_needed_error() && !print_index.seek_layer(parser.value_ulong()))
+        SERIAL_ECHO_MSG("No layer index.");
+      return;
+    }
+  #endif
+
+  if (parser.seenval('S'))
     card.setIndex(parser.value_long());
 }
 
@@ -535,3 +535,12 @@
 #if EITHER(MEATPACK_ON_SERIAL_PORT_1, MEATPACK_ON_SERIAL_PORT_2)
   #define HAS_MEATPACK 1
 #endif
+
+#if SERIAL_RESEND_WINDOW > 0
+  #define HAS_SERIAL_RESEND_WINDOW 1
+#endif
+
+// Commands may be queued already parsed
+#if EITHER(BINARY_GCODE, PREPARSED_GCODE_QUEUE)
+  #define HAS_PARSED_GCODE 1
+#endif
@@ -760,6 +760,61 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "LIGHTWEIGHT_UI requires a U8GLIB_ST7920-based display."
 #endif
 
+/**
+ * SD Read-Ahead
+ */
+#if SD_READ_AHEAD
+  #if DISABLED(SDSUPPORT)
+    #error "SD_READ_AHEAD requires SDSUPPORT."
+  #elif !WITHIN(SD_READ_AHEAD, 2, 16)
+    #error "SD_READ_AHEAD must be between 2 and 16."
+  #endif
+#endif
+
+/**
+ * SD Directory Index
+ */
+#if SD_DIR_INDEX
+  #if DISABLED(SDSUPPORT)
+    #error "SD_DIR_INDEX requires SDSUPPORT."
+  #elif !WITHIN(SD_DIR_INDEX, 16, 4096)
+    #error "SD_DIR_INDEX must be between 16 and 4096."
+  #endif
+#endif
+
+/**
+ * SD Print Index
+ */
+#if ENABLED(SD_PRINT_INDEX) && DISABLED(SDSUPPORT)
+  #error "SD_PRINT_INDEX requires SDSUPPORT."
+#endif
+
+/**
+ * SD Log Buffer
+ */
+#if ENABLED(SD_LOG_BUFFER)
+  #if DISABLED(SDSUPPORT)
+    #error "SD_LOG_BUFFER requires SDSUPPORT."
+  #elif ENABLED(SDCARD_READONLY)
+    #error "SD_LOG_BUFFER cannot be used with SDCARD_READONLY."
+  #elif !defined(SD_LOG_FLUSH_INTERVAL) || SD_LOG_FLUSH_INTERVAL < 1
+    #error "SD_LOG_BUFFER requires an SD_LOG_FLUSH_INTERVAL of at least 1 second."
+  #elif !defined(SD_LOG_PREALLOCATE) || SD_LOG_PREALLOCATE < 0
+    #error "SD_LOG_BUFFER requires SD_LOG_PREALLOCATE (0 to disable)."
+  #endif
+#endif
+
+/**
+ * Binary File Transfer Buffer
+ */
+#if BINARY_FILE_TRANSFER_BLOCKS
+  #if DISABLED(BINARY_FILE_TRANSFER)
+    #error "BINARY_FILE_TRANSFER_BLOCKS requires BINARY_FILE_TRANSFER."
+  #elif BINARY_FILE_TRANSFER_BLOCKS != 2 && BINARY_FILE_TRANSFER_BLOCKS != 4 && BINARY_FILE_TRANSFER_BLOCKS != 8 && BINARY_FILE_TRANSFER_BLOCKS != 16
+    #error "BINARY_FILE_TRANSFER_BLOCKS must be 2, 4, 8, or 16."
+  #endif
+#endif
+
 /**
  * SD File Sorting
  */
@@ -1286,6 +1341,17 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #endif
 #endif
 
+/**
+ * SCARA requirements
+ */
+#if ENABLED(SCARA_TRIG_TABLE)
+  #if !IS_SCARA
+    #error "SCARA_TRIG_TABLE requires MORGAN_SCARA, MP_SCARA, or AXEL_TPARA."
+  #elif !defined(SCARA_TRIG_TABLE_SIZE) || SCARA_TRIG_TABLE_SIZE < 16 || SCARA_TRIG_TABLE_SIZE > 4096 || (SCARA_TRIG_TABLE_SIZE & (SCARA_TRIG_TABLE_SIZE - 1))
+    #error "SCARA_TRIG_TABLE_SIZE must be a power of 2 from 16 to 4096."
+  #endif
+#endif
+
 /**
  * Junction deviation is incompatible with kinematic systems.
  */
@@ -1447,6 +1513,23 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #endif
   #endif
 
+  #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+    #if MULTIPLE_PROBING > 0
+      #error "PROBE_ADAPTIVE_SAMPLING replaces MULTIPLE_PROBING. Disable one of them."
+    #elif !defined(PROBE_SAMPLES_MIN) || !defined(PROBE_SAMPLES_MAX)
+      #error "PROBE_ADAPTIVE_SAMPLING requires PROBE_SAMPLES_MIN and PROBE_SAMPLES_MAX."
+    #elif PROBE_SAMPLES_MIN < 2
+      #error "PROBE_SAMPLES_MIN must be 2 or more."
+    #elif PROBE_SAMPLES_MAX < PROBE_SAMPLES_MIN
+      #error "PROBE_SAMPLES_MAX must be greater than or equal to PROBE_SAMPLES_MIN."
+    #elif PROBE_SAMPLES_MAX > 16
+      #error "PROBE_SAMPLES_MAX must be 16 or less."
+    #endif
+    static_assert(PROBE_SAMPLE_TOLERANCE > 0, "PROBE_SAMPLE_TOLERANCE must be greater than 0.");
+    static_assert(PROBE_SAMPLE_MAD_LIMIT > 0, "PROBE_SAMPLE_MAD_LIMIT must be greater than 0.");
+    static_assert(PROBE_SAMPLE_CLEARANCE > 0, "PROBE_SAMPLE_CLEARANCE must be greater than 0.");
+  #endif
+
   #if Z_PROBE_LOW_POINT > 0
     #error "Z_PROBE_LOW_POINT must be less than or equal to 0."
   #endif
@@ -1559,6 +1642,38 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "MESH_EDIT_GFX_OVERLAY requires AUTO_BED_LEVELING_UBL and a Graphical LCD."
 #endif
 
+#if ENABLED(PROBE_PATH_OPTIMIZER)
+  #if NONE(AUTO_BED_LEVELING_LINEAR, AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL, MESH_BED_LEVELING)
+    #error "PROBE_PATH_OPTIMIZER requires MESH_BED_LEVELING, AUTO_BED_LEVELING_LINEAR, AUTO_BED_LEVELING_BILINEAR, or AUTO_BED_LEVELING_UBL."
+  #elif BOTH(PROBE_MANUALLY, HAS_ABL_NOT_UBL)
+    #error "PROBE_PATH_OPTIMIZER is not compatible with PROBE_MANUALLY."
+  #elif !defined(PROBE_PATH_2OPT_PASSES) || PROBE_PATH_2OPT_PASSES < 0
+    #error "PROBE_PATH_OPTIMIZER requires PROBE_PATH_2OPT_PASSES >= 0."
+  #endif
+#endif
+
+#if ENABLED(MESH_BANK)
+  #if DISABLED(OPTIMIZED_MESH_STORAGE)
+    #error "MESH_BANK requires OPTIMIZED_MESH_STORAGE."
+  #elif !defined(MESH_BANK_SLOT_SIZE) || MESH_BANK_SLOT_SIZE < 16 || MESH_BANK_SLOT_SIZE > 4096
+    #error "MESH_BANK_SLOT_SIZE must be from 16 to 4096."
+  #endif
+#endif
+
+#if ENABLED(PROBE_FLYBY_SCAN)
+  #if DISABLED(AUTO_BED_LEVELING_UBL)
+    #error "PROBE_FLYBY_SCAN requires AUTO_BED_LEVELING_UBL."
+  #elif DISABLED(FIX_MOUNTED_PROBE)
+    #error "PROBE_FLYBY_SCAN requires FIX_MOUNTED_PROBE (a non-contact probe)."
+  #elif !IS_FULL_CARTESIAN || ENABLED(MARKFORGED_XY)
+    #error "PROBE_FLYBY_SCAN requires Cartesian kinematics."
+  #elif !defined(PROBE_SCAN_EVENTS) || !WITHIN(PROBE_SCAN_EVENTS, 2, 255)
+    #error "PROBE_SCAN_EVENTS must be from 2 to 255."
+  #endif
+  static_assert(PROBE_SCAN_Z_STEP > 0, "PROBE_SCAN_Z_STEP must be greater than 0.");
+  static_assert(PROBE_SCAN_RANGE >= 0, "PROBE_SCAN_RANGE must be 0 or greater.");
+#endif
+
 #if ENABLED(G29_RETRY_AND_RECOVER)
   #if ENABLED(AUTO_BED_LEVELING_UBL)
     #error "G29_RETRY_AND_RECOVER is not compatible with UBL."
@@ -2905,6 +3020,8 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
     #error "You can't enable POWER_LOSS_PULLUP and POWER_LOSS_PULLDOWN at the same time."
   #elif BOTH(IS_CARTESIAN, POWER_LOSS_RECOVER_ZHOME) && Z_HOME_DIR < 0 && !defined(POWER_LOSS_ZHOME_POS)
     #error "POWER_LOSS_RECOVER_ZHOME requires POWER_LOSS_ZHOME_POS for a Cartesian that homes to ZMIN."
+  #elif defined(POWER_LOSS_RECOVERY_SLOTS) && !WITHIN(POWER_LOSS_RECOVERY_SLOTS, 2, 16)
+    #error "POWER_LOSS_RECOVERY_SLOTS must be from 2 to 16."
   #endif
 #endif
 
@@ -3221,6 +3338,51 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
 #if BOTH(HAS_MEATPACK, BINARY_FILE_TRANSFER)
   #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_FILE_TRANSFER, not both."
 #endif
+#if ENABLED(MEATPACK_HEATSHRINK) && !HAS_MEATPACK
+  #error "MEATPACK_HEATSHRINK requires MEATPACK_ON_SERIAL_PORT_1 or MEATPACK_ON_SERIAL_PORT_2."
+#endif
+
+/**
+ * Sanity Check for BINARY_GCODE
+ */
+#if ENABLED(BINARY_GCODE)
+  #if DISABLED(FASTER_GCODE_PARSER)
+    #error "BINARY_GCODE requires FASTER_GCODE_PARSER."
+  #elif HAS_MEATPACK
+    #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_GCODE, not both."
+  #endif
+#endif
+
+/**
+ * Sanity Check for PREPARSED_GCODE_QUEUE
+ */
+#if ENABLED(PREPARSED_GCODE_QUEUE)
+  #if DISABLED(FASTER_GCODE_PARSER)
+    #error "PREPARSED_GCODE_QUEUE requires FASTER_GCODE_PARSER."
+  #elif !defined(PREPARSED_TEXT_BUFSIZE) || PREPARSED_TEXT_BUFSIZE < 1
+    #error "PREPARSED_TEXT_BUFSIZE must be 1 or more."
+  #elif !WITHIN(PREPARSED_GCODE_PARAMS, 1, 26)
+    #error "PREPARSED_GCODE_PARAMS must be from 1 to 26."
+  #endif
+#endif
+
+#if SERIAL_READ_CHUNK && !WITHIN(SERIAL_READ_CHUNK, 2, 255)
+  #error "SERIAL_READ_CHUNK must be between 2 and 255."
+#endif
+
+#if SERIAL_OUTPUT_BUFFER && !WITHIN(SERIAL_OUTPUT_BUFFER, 16, 255)
+  #error "SERIAL_OUTPUT_BUFFER must be between 16 and 255."
+#endif
+
+#if ENABLED(SERIAL_FLOW_CREDITS) && !(RX_BUFFER_SIZE > 0)
+  #error "SERIAL_FLOW_CREDITS requires an RX_BUFFER_SIZE for the credit window."
+#elif BOTH(SERIAL_FLOW_CREDITS, HAS_MEATPACK)
+  #error "SERIAL_FLOW_CREDITS counts bytes after decoding, so it can't be used with MEATPACK_ON_SERIAL_PORT_*."
+#endif
+
+#if ENABLED(GCODE_DISPATCH_STATS) && DISABLED(MARLIN_DEV_MODE)
+  #error "GCODE_DISPATCH_STATS requires MARLIN_DEV_MODE for D8."
+#endif
 
 /**
  * Sanity check for unique start and stop values in NOZZLE_CLEAN_FEATURE
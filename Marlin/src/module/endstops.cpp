@@ -292,6 +292,43 @@ void Endstops::init() {
 
 } // Endstops::init
 
+#if ENABLED(PROBE_FLYBY_SCAN)
+
+  volatile bool Endstops::scan_active; // = false
+  bool Endstops::scan_state, Endstops::scan_overflow;
+
+  static Endstops::scan_event_t scan_events[PROBE_SCAN_EVENTS];
+  static volatile uint8_t scan_head, scan_tail;
+
+  // Clear the latched events and take the current probe state
+  void Endstops::scan_start() {
+    scan_head = scan_tail = 0;
+    scan_overflow = false;
+    scan_state = PROBE_TRIGGERED();
+    scan_active = true;
+  }
+
+  // Get the oldest latched event. Return false if there are none.
+  bool Endstops::scan_event(scan_event_t &ev) {
+    if (scan_tail == scan_head) return false;
+    ev = scan_events[scan_tail];
+    scan_tail = (scan_tail + 1) % (PROBE_SCAN_EVENTS);
+    return true;
+  }
+
+  // Latch the XY position of a probe edge without stopping the move. Called from ISR contexts.
+  static inline void scan_latch() {
+    const bool hit = PROBE_TRIGGERED();
+    if (hit == endstops.scan_state) return;
+    endstops.scan_state = hit;
+    const uint8_t next = (scan_head + 1) % (PROBE_SCAN_EVENTS);
+    if (next == scan_tail) { endstops.scan_overflow = true; return; }
+    scan_events[scan_head] = { stepper.position(X_AXIS), stepper.position(Y_AXIS), hit };
+    scan_head = next;
+  }
+
+#endif // PROBE_FLYBY_SCAN
+
 // Called at ~1KHz from Temperature ISR: Poll endstop state if required
 void Endstops::poll() {
 
@@ -501,6 +538,10 @@ void _O2 Endstops::report_states() {
 // Check endstops - Could be called from Temperature ISR!
 void Endstops::update() {
 
+  #if ENABLED(PROBE_FLYBY_SCAN)
+    if (scan_active) scan_latch();
+  #endif
+
   #if !ENDSTOP_NOISE_THRESHOLD
     if (!abort_enabled()) return;
   #endif
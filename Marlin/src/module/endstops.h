@@ -167,6 +167,16 @@ class Endstops {
 
     static void resync();
 
+    #if ENABLED(PROBE_FLYBY_SCAN)
+      // Probe edges latched during a fly-by scan move, in steps
+      typedef struct { int32_t x, y; bool triggered; } scan_event_t;
+      static volatile bool scan_active;
+      static bool scan_state, scan_overflow;
+      static void scan_start();
+      static void scan_stop() { scan_active = false; }
+      static bool scan_event(scan_event_t &ev);
+    #endif
+
     // Debugging of endstops
     #if ENABLED(PINS_DEBUGGING)
       static bool monitor_flag;
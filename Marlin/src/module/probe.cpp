@@ -88,6 +88,11 @@ Probe probe;
 
 xyz_pos_t Probe::offset; // Initialized by settings.load()
 
+#if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+  uint8_t Probe::sample_count;
+  float Probe::sample_spread;
+#endif
+
 #if HAS_PROBE_XY_OFFSET
   const xy_pos_t &Probe::offset_xy = Probe::offset;
 #endif
@@ -577,6 +582,56 @@ bool Probe::probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s) {
   }
 #endif
 
+#if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+
+  /**
+   * @brief Average the probe readings that agree with the median.
+   *
+   * @details Readings farther than PROBE_SAMPLE_MAD_LIMIT Median Absolute
+   *          Deviations from the median are rejected. Sets sample_spread
+   *          to the range of the accepted readings.
+   *
+   * @param probes  Readings sorted in ascending order
+   * @param count   Number of readings
+   *
+   * @return The average of the accepted readings
+   */
+  float Probe::sample_average(const float probes[], const uint8_t count) {
+    auto median_of = [](const float sorted[], const uint8_t n) {
+      const uint8_t h = (n - 1) / 2;
+      return (n & 1) ? sorted[h] : (sorted[h] + sorted[h + 1]) * 0.5f;
+    };
+
+    const float median = median_of(probes, count);
+
+    // Sorted absolute deviations from the median
+    float dev[PROBE_SAMPLES_MAX];
+    LOOP_L_N(p, count) {
+      const float d = ABS(probes[p] - median);
+      int8_t m = p;
+      for (; m > 0 && dev[m - 1] > d; --m) dev[m] = dev[m - 1];
+      dev[m] = d;
+    }
+
+    // Never reject readings that are within tolerance of the median
+    const float limit = _MAX(median_of(dev, count) * (PROBE_SAMPLE_MAD_LIMIT), float(PROBE_SAMPLE_TOLERANCE) * 0.5f);
+
+    float sum = 0, lo = 0, hi = 0;
+    uint8_t accepted = 0;
+    LOOP_L_N(p, count) {
+      if (ABS(probes[p] - median) > limit) continue;
+      if (!accepted) lo = probes[p];
+      hi = probes[p];
+      sum += probes[p];
+      accepted++;
+    }
+
+    sample_spread = hi - lo;
+    return sum / accepted;
+  }
+
+#endif
+
 /**
  * @brief Probe at the current XY (possibly more than once) to find the bed Z.
  *
@@ -642,6 +697,36 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
     }
   #endif
 
+  #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+
+    // Take slow probes until the accepted readings agree, or the limit is reached
+    float probes[PROBE_SAMPLES_MAX], measured_z;
+    for (sample_count = 0;;) {
+      if (TERN0(PROBE_TARE, tare())) return NAN;
+
+      if (try_to_probe(PSTR("SLOW"), z_probe_low_point, MMM_TO_MMS(Z_PROBE_FEEDRATE_SLOW),
+                       sanity_check, Z_CLEARANCE_MULTI_PROBE) ) return NAN;
+
+      TERN_(MEASURE_BACKLASH_WHEN_PROBING, backlash.measure_with_probe());
+
+      // Insert Z measurement into probes[]. Keep it sorted ascending.
+      const float z = current_position.z;
+      int8_t m = sample_count;
+      for (; m > 0 && probes[m - 1] > z; --m) probes[m] = probes[m - 1];
+      probes[m] = z;
+
+      if (++sample_count >= PROBE_SAMPLES_MIN) {
+        measured_z = sample_average(probes, sample_count);
+        if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPAIR("Samples:", sample_count, " Spread:", sample_spread, " Z:", measured_z);
+        if (sample_spread <= PROBE_SAMPLE_TOLERANCE || sample_count >= PROBE_SAMPLES_MAX) break;
+      }
+
+      // Short raise to release the probe before the next sample
+      do_blocking_move_to_z(z + PROBE_SAMPLE_CLEARANCE, z_probe_fast_mm_s);
+    }
+
+  #else // !PROBE_ADAPTIVE_SAMPLING
+
   #if EXTRA_PROBING > 0
     float probes[TOTAL_PROBING];
   #endif
@@ -731,6 +816,8 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
 
   #endif
 
+  #endif // !PROBE_ADAPTIVE_SAMPLING
+
   return measured_z;
 }
 
@@ -774,6 +861,10 @@ float Probe::probe_at_point(const_float_t rx, const_float_t ry, const ProbePtRai
   // Move the probe to the starting XYZ
   do_blocking_move_to(npos, feedRate_t(XY_PROBE_FEEDRATE_MM_S));
 
+  #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+    const millis_t probe_start_ms = millis();
+  #endif
+
   float measured_z = NAN;
   if (!deploy()) measured_z = run_z_probe(sanity_check) + offset.z;
   if (!isnan(measured_z)) {
@@ -783,8 +874,14 @@ float Probe::probe_at_point(const_float_t rx, const_float_t ry, const ProbePtRai
     else if (raise_after == PROBE_PT_STOW)
       if (stow()) measured_z = NAN;   // Error on stow?
 
-    if (verbose_level > 2)
+    if (verbose_level > 2) {
       SERIAL_ECHOLNPAIR("Bed X: ", LOGICAL_X_POSITION(rx), " Y: ", LOGICAL_Y_POSITION(ry), " Z: ", measured_z);
+      #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+        SERIAL_ECHOPAIR(" Samples: ", sample_count);
+        SERIAL_ECHOPAIR_F(" Spread: ", sample_spread, 4);
+        SERIAL_ECHOLNPAIR(" Time: ", millis() - probe_start_ms, "ms");
+      #endif
+    }
   }
 
   if (isnan(measured_z)) {
@@ -60,6 +60,11 @@ public:
 
     static xyz_pos_t offset;
 
+    #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+      static uint8_t sample_count;  // Slow probes taken at the last point
+      static float sample_spread;   // Range of the accepted readings at the last point
+    #endif
+
     #if EITHER(PREHEAT_BEFORE_PROBING, PREHEAT_BEFORE_LEVELING)
       static void preheat_for_probing(const celsius_t hotend_temp, const celsius_t bed_temp);
     #endif
@@ -260,6 +265,9 @@ private:
   static bool probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s);
   static void do_z_raise(const float z_raise);
   static float run_z_probe(const bool sanity_check=true);
+  #if ENABLED(PROBE_ADAPTIVE_SAMPLING)
+    static float sample_average(const float probes[], const uint8_t count);
+  #endif
 };
 
 extern Probe probe;
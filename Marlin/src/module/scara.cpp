@@ -39,6 +39,82 @@
 
 float segments_per_second = TERN(AXEL_TPARA, TPARA_SEGMENTS_PER_SECOND, SCARA_SEGMENTS_PER_SECOND);
 
+#if ENABLED(SCARA_TRIG_TABLE)
+
+  /**
+   * Interpolated lookup tables for the arm trig terms.
+   * 'sine' holds one quarter wave and 'arctan' covers ratios 0 to 1.
+   * Other quadrants and octants are found by symmetry.
+   */
+  class ScaraTrig {
+    static constexpr uint16_t N = SCARA_TRIG_TABLE_SIZE;
+    static float sine[N + 1], arctan[N + 1];
+
+  public:
+    static void init() {
+      for (uint16_t i = 0; i <= N; i++) {
+        sine[i] = sinf(float(M_PI_2) * i / N);
+        arctan[i] = atanf(float(i) / N);
+      }
+    }
+
+    static float sin(const_float_t rad) {
+      const float t = rad * float(N / M_PI_2);
+      const int32_t i = FLOOR(t);
+      const float f = t - i;
+      const uint32_t u = uint32_t(i);                 // Wraps modulo 4N for negative angles
+      const uint16_t k = u & (N - 1);
+      float a, b;
+      switch ((u / N) & 3) {
+        default:
+        case 0: a =  sine[k];     b =  sine[k + 1];     break;
+        case 1: a =  sine[N - k]; b =  sine[N - k - 1]; break;
+        case 2: a = -sine[k];     b = -sine[k + 1];     break;
+        case 3: a = -sine[N - k]; b = -sine[N - k - 1]; break;
+      }
+      return a + (b - a) * f;
+    }
+
+    static float cos(const_float_t rad) { return sin(rad + float(M_PI_2)); }
+
+    static float atan2(const_float_t y, const_float_t x) {
+      const float ax = ABS(x), ay = ABS(y);
+      if (ax == 0 && ay == 0) return 0;
+      const bool steep = ay > ax;
+      const float t = (steep ? ax / ay : ay / ax) * N;
+      const uint16_t k = _MIN(uint16_t(t), N - 1);
+      float a = arctan[k] + (arctan[k + 1] - arctan[k]) * (t - k);
+      if (steep) a = float(M_PI_2) - a;
+      if (x < 0) a = float(M_PI) - a;
+      return y < 0 ? -a : a;
+    }
+
+    static float acos(const_float_t c) {
+      const float cc = constrain(c, -1, 1);
+      return atan2(SQRT(1.0f - sq(cc)), cc);
+    }
+  };
+
+  float ScaraTrig::sine[ScaraTrig::N + 1], ScaraTrig::arctan[ScaraTrig::N + 1];
+  static ScaraTrig scara_trig;
+
+  // Fill the tables. Called early in setup(), before any kinematics.
+  void scara_trig_init() { scara_trig.init(); }
+
+  #define SCARA_SIN(A)     scara_trig.sin(A)
+  #define SCARA_COS(A)     scara_trig.cos(A)
+  #define SCARA_ATAN2(Y,X) scara_trig.atan2(Y, X)
+  #define SCARA_ACOS(A)    scara_trig.acos(A)
+
+#else
+
+  #define SCARA_SIN(A)     sin(A)
+  #define SCARA_COS(A)     cos(A)
+  #define SCARA_ATAN2(Y,X) ATAN2(Y, X)
+  #define SCARA_ACOS(A)    ACOS(A)
+
+#endif
+
 #if EITHER(MORGAN_SCARA, MP_SCARA)
 
   static constexpr xy_pos_t scara_offset = { SCARA_OFFSET_X, SCARA_OFFSET_Y };
@@ -49,14 +125,26 @@ float segments_per_second = TERN(AXEL_TPARA, TPARA_SEGMENTS_PER_SECOND, SCARA_SE
    * Integrated into Marlin and slightly restructured by Joachim Cerny.
    */
   void forward_kinematics(const_float_t a, const_float_t b) {
-    const float a_sin = sin(RADIANS(a)) * L1,
-                a_cos = cos(RADIANS(a)) * L1,
-                b_sin = sin(RADIANS(SUM_TERN(MP_SCARA, b, a))) * L2,
-                b_cos = cos(RADIANS(SUM_TERN(MP_SCARA, b, a))) * L2;
+    #if ENABLED(SCARA_TRIG_TABLE)
+      // Reuse the last result if the arm hasn't moved
+      static ab_float_t last_ab = { NAN, NAN };
+      static xy_pos_t last_xy;
+      if (a == last_ab.a && b == last_ab.b) { cartes.x = last_xy.x; cartes.y = last_xy.y; return; }
+    #endif
+
+    const float a_sin = SCARA_SIN(RADIANS(a)) * L1,
+                a_cos = SCARA_COS(RADIANS(a)) * L1,
+                b_sin = SCARA_SIN(RADIANS(SUM_TERN(MP_SCARA, b, a))) * L2,
+                b_cos = SCARA_COS(RADIANS(SUM_TERN(MP_SCARA, b, a))) * L2;
 
     cartes.x = a_cos + b_cos + scara_offset.x;  // theta
     cartes.y = a_sin + b_sin + scara_offset.y;  // phi
 
+    #if ENABLED(SCARA_TRIG_TABLE)
+      last_ab.set(a, b);
+      last_xy = cartes;
+    #endif
+
     /*
       DEBUG_ECHOLNPAIR(
         "SCARA FK Angle a=", a,
@@ -122,10 +210,10 @@ float segments_per_second = TERN(AXEL_TPARA, TPARA_SEGMENTS_PER_SECOND, SCARA_SE
     SK2 = L2 * S2;
 
     // Angle of Arm1 is the difference between Center-to-End angle and the Center-to-Elbow
-    THETA = ATAN2(SK1, SK2) - ATAN2(spos.x, spos.y);
+    THETA = SCARA_ATAN2(SK1, SK2) - SCARA_ATAN2(spos.x, spos.y);
 
     // Angle of Arm2
-    PSI = ATAN2(S2, C2);
+    PSI = SCARA_ATAN2(S2, C2);
 
     delta.set(DEGREES(THETA), DEGREES(SUM_TERN(MORGAN_SCARA, PSI, THETA)), raw.z);
 
@@ -163,9 +251,9 @@ float segments_per_second = TERN(AXEL_TPARA, TPARA_SEGMENTS_PER_SECOND, SCARA_SE
 
   void inverse_kinematics(const xyz_pos_t &raw) {
     const float x = raw.x, y = raw.y, c = HYPOT(x, y),
-                THETA3 = ATAN2(y, x),
-                THETA1 = THETA3 + ACOS((sq(c) + sq(L1) - sq(L2)) / (2.0f * c * L1)),
-                THETA2 = THETA3 - ACOS((sq(c) + sq(L2) - sq(L1)) / (2.0f * c * L2));
+                THETA3 = SCARA_ATAN2(y, x),
+                THETA1 = THETA3 + SCARA_ACOS((sq(c) + sq(L1) - sq(L2)) / (2.0f * c * L1)),
+                THETA2 = THETA3 - SCARA_ACOS((sq(c) + sq(L2) - sq(L1)) / (2.0f * c * L2));
 
     delta.set(DEGREES(THETA1), DEGREES(THETA2), raw.z);
 
@@ -198,13 +286,25 @@ float segments_per_second = TERN(AXEL_TPARA, TPARA_SEGMENTS_PER_SECOND, SCARA_SE
 
   // Convert ABC inputs in degrees to XYZ outputs in mm
   void forward_kinematics(const_float_t a, const_float_t b, const_float_t c) {
+    #if ENABLED(SCARA_TRIG_TABLE)
+      // Reuse the last result if the arm hasn't moved
+      static abc_float_t last_abc = { NAN, NAN, NAN };
+      static xyz_pos_t last_xyz;
+      if (a == last_abc.a && b == last_abc.b && c == last_abc.c) { cartes = last_xyz; return; }
+    #endif
+
     const float w = c - b,
-                r = L1 * cos(RADIANS(b)) + L2 * sin(RADIANS(w - (90 - b))),
-                x = r  * cos(RADIANS(a)),
-                y = r  * sin(RADIANS(a)),
-                rho2 = L1_2 + L2_2 - 2.0f * L1 * L2 * cos(RADIANS(w));
+                r = L1 * SCARA_COS(RADIANS(b)) + L2 * SCARA_SIN(RADIANS(w - (90 - b))),
+                x = r  * SCARA_COS(RADIANS(a)),
+                y = r  * SCARA_SIN(RADIANS(a)),
+                rho2 = L1_2 + L2_2 - 2.0f * L1 * L2 * SCARA_COS(RADIANS(w));
 
     cartes = robot_offset + xyz_pos_t({ x, y, SQRT(rho2 - sq(x) - sq(y)) });
+
+    #if ENABLED(SCARA_TRIG_TABLE)
+      last_abc.set(a, b, c);
+      last_xyz = cartes;
+    #endif
   }
 
   // Home YZ together, then X (or all at once). Based on quick_home_xy & home_delta
@@ -274,15 +374,15 @@ float segments_per_second = TERN(AXEL_TPARA, TPARA_SEGMENTS_PER_SECOND, SCARA_SE
                 K2 = L2 * SG,
 
                 // Angle of Body Joint
-                THETA = ATAN2(spos.y, spos.x),
+                THETA = SCARA_ATAN2(spos.y, spos.x),
 
                 // Angle of Elbow Joint
                 //GAMMA = ACOS(CG),
-                GAMMA = ATAN2(SG, CG), // Method 2
+                GAMMA = SCARA_ATAN2(SG, CG), // Method 2
 
                 // Angle of Shoulder Joint, elevation angle measured from horizontal (r+)
                 //PHI = asin(spos.z/RHO) + asin(L2 * sin(GAMMA) / RHO),
-                PHI = ATAN2(spos.z, RXY) + ATAN2(K2, K1),   // Method 2
+                PHI = SCARA_ATAN2(spos.z, RXY) + SCARA_ATAN2(K2, K1),   // Method 2
 
                 // Elbow motor angle measured from horizontal, same frame as shoulder  (r+)
                 PSI = PHI + GAMMA;
@@ -306,4 +406,52 @@ void scara_report_positions() {
   SERIAL_EOL();
 }
 
+#if BOTH(SCARA_TRIG_TABLE, MARLIN_DEV_MODE)
+
+  /**
+   * D105: Compare the tables with the math library over 'count' inputs.
+   * Report the largest error of each term, the largest error of an XY
+   * position after inverse kinematics, and the time taken by each.
+   */
+  void scara_trig_report(const uint32_t count) {
+    uint32_t seed = 105;
+    auto rnd = [&]{ seed = seed * 1664525UL + 1013904223UL; return float(seed >> 8) / float(_BV32(24)); };
+
+    float err_sin = 0, err_atan2 = 0, err_acos = 0, err_xy = 0;
+    for (uint32_t i = 0; i < count; i++) {
+      const float r = (rnd() - 0.5f) * float(4 * M_PI), y = rnd() - 0.5f, x = rnd() - 0.5f, c = rnd() * 2 - 1;
+      NOLESS(err_sin, ABS(scara_trig.sin(r) - sinf(r)));
+      NOLESS(err_atan2, ABS(scara_trig.atan2(y, x) - atan2f(y, x)));
+      NOLESS(err_acos, ABS(scara_trig.acos(c) - acosf(c)));
+    }
+
+    #if EITHER(MORGAN_SCARA, MP_SCARA)
+      // Solve for points in reach, then turn the angles back into XY with the math library
+      const abc_pos_t saved_delta = delta;
+      for (uint32_t i = 0; i < _MIN(count, 10000UL); i++) {
+        const float reach = ABS(L1 - L2) + 1 + rnd() * (L1 + L2 - ABS(L1 - L2) - 2), angle = rnd() * float(2 * M_PI);
+        const xyz_pos_t raw = { scara_offset.x + reach * cosf(angle), scara_offset.y + reach * sinf(angle), 0 };
+        inverse_kinematics(raw);
+        const float a = RADIANS(delta.a), b = RADIANS(SUM_TERN(MP_SCARA, delta.b, delta.a));
+        NOLESS(err_xy, HYPOT(L1 * cosf(a) + L2 * cosf(b) + scara_offset.x - raw.x, L1 * sinf(a) + L2 * sinf(b) + scara_offset.y - raw.y));
+      }
+      delta = saved_delta;
+    #endif
+
+    volatile float sum = 0;   // Keep the timed loops from being optimized out
+    float a = 0;
+    uint32_t start = micros();
+    for (uint32_t i = 0; i < count; i++) { sum += scara_trig.sin(a) + scara_trig.atan2(a, 1.5f); a += 0.0001f; }
+    const uint32_t table_us = micros() - start;
+    a = 0;
+    start = micros();
+    for (uint32_t i = 0; i < count; i++) { sum += sinf(a) + atan2f(a, 1.5f); a += 0.0001f; }
+    const uint32_t libm_us = micros() - start;
+
+    SERIAL_ECHOLNPAIR("D105 error(1e-6) sin:", err_sin * 1e6f, " atan2:", err_atan2 * 1e6f, " acos:", err_acos * 1e6f,
+      " xy(um):", err_xy * 1e3f, " table:", table_us, "us libm:", libm_us, "us");
+  }
+
+#endif
+
 #endif // IS_SCARA
@@ -50,4 +50,10 @@ extern float segments_per_second;
 
 void inverse_kinematics(const xyz_pos_t &raw);
 void scara_set_axis_is_at_home(const AxisEnum axis);
+#if ENABLED(SCARA_TRIG_TABLE)
+  void scara_trig_init();
+  #if ENABLED(MARLIN_DEV_MODE)
+    void scara_trig_report(const uint32_t count);
+  #endif
+#endif
 void scara_report_positions();
@@ -2540,14 +2540,94 @@ void MarlinSettings::postprocess() {
                                                           // or down a little bit without disrupting the mesh data
     }
 
-    #define MESH_STORE_SIZE sizeof(TERN(OPTIMIZED_MESH_STORAGE, mesh_store_t, ubl.z_values))
+    #if ENABLED(MESH_BANK)
+
+      #define MESH_STORE_SIZE MESH_BANK_SLOT_SIZE
+
+      /**
+       * A mesh bank slot holds a mesh packed by ubl.pack_mesh_store.
+       * A hidden reference slot above slot 0 holds the first mesh saved, packed
+       * as-is. It's never overwritten, so user slots can be packed as differences
+       * from it. They keep its CRC so a changed reference is still detected.
+       */
+      typedef struct {
+        uint16_t crc,                     // CRC of the rest of the slot
+                 ref_crc,                 // CRC of the reference slot
+                 len;                     // Packed length, with MESH_BANK_RELATIVE flag
+        uint8_t data[MESH_BANK_SLOT_SIZE - 6];
+      } mesh_bank_slot_t;
+
+      #define MESH_BANK_RELATIVE 0x8000
+      #define MESH_BANK_REF -1            // Slot index of the reference mesh
+      #define MESH_BANK_HEADER_SIZE (sizeof(mesh_bank_slot_t) - sizeof(mesh_bank_slot_t::data))
+
+      uint32_t MarlinSettings::mesh_load_us; // = 0
+
+      static uint16_t mesh_bank_crc(const mesh_bank_slot_t &bank) {
+        uint16_t crc = 0;
+        crc16(&crc, &bank.ref_crc, sizeof(bank.ref_crc) + sizeof(bank.len));
+        crc16(&crc, bank.data, bank.len & ~MESH_BANK_RELATIVE);
+        return crc;
+      }
+
+      // Read and unpack a mesh bank slot. Return false if the slot or its reference is invalid.
+      static bool mesh_bank_read(const int8_t slot, mesh_store_t &stored_values, uint16_t &slot_crc) {
+        mesh_bank_slot_t bank;
+        int pos = settings.mesh_slot_offset(slot);
+        uint16_t dummy_crc = 0;
+        if (persistentStore.read_data(pos, (uint8_t*)&bank, MESH_BANK_HEADER_SIZE, &dummy_crc)) return false;
+        const uint16_t len = bank.len & ~MESH_BANK_RELATIVE;
+        if (len > sizeof(bank.data)) return false;
+        if (persistentStore.read_data(pos, bank.data, len, &dummy_crc)) return false;
+        if (mesh_bank_crc(bank) != bank.crc) return false;
+        slot_crc = bank.crc;
+
+        mesh_store_t ref_values = { { 0 } };
+        if (bank.len & MESH_BANK_RELATIVE) {
+          uint16_t ref_crc;
+          if (slot == MESH_BANK_REF || !mesh_bank_read(MESH_BANK_REF, ref_values, ref_crc)) return false;
+          if (ref_crc != bank.ref_crc) {
+            SERIAL_ECHOLNPGM("?Reference mesh has changed.");
+            return false;
+          }
+        }
+        return ubl.unpack_mesh_store(bank.data, len, ref_values, stored_values);
+      }
+
+      // Pack a mesh into a slot, relative to a reference if given. Return false if it doesn't fit.
+      static bool mesh_bank_pack(mesh_bank_slot_t &bank, const mesh_store_t &stored_values, const mesh_store_t * const ref_values=nullptr, const uint16_t ref_crc=0) {
+        static const mesh_store_t zero_values = { { 0 } };
+        const uint16_t len = ubl.pack_mesh_store(stored_values, ref_values ? *ref_values : zero_values, bank.data, sizeof(bank.data));
+        if (!len) return false;
+        bank.ref_crc = ref_crc;
+        bank.len = len | (ref_values ? MESH_BANK_RELATIVE : 0);
+        bank.crc = mesh_bank_crc(bank);
+        return true;
+      }
+
+      // Write a packed slot. Return true on error, like persistentStore.
+      static bool mesh_bank_write(const int8_t slot, mesh_bank_slot_t &bank) {
+        const uint16_t size = MESH_BANK_HEADER_SIZE + (bank.len & ~MESH_BANK_RELATIVE);
+        int pos = settings.mesh_slot_offset(slot);
+        uint16_t crc = 0;
+        const bool status = persistentStore.write_data(pos, (uint8_t*)&bank, size, &crc);
+        if (!status) DEBUG_ECHOLNPAIR("Mesh packed into ", size, " bytes");
+        return status;
+      }
+
+    #else
+
+      #define MESH_STORE_SIZE sizeof(TERN(OPTIMIZED_MESH_STORAGE, mesh_store_t, ubl.z_values))
+
+    #endif
 
     uint16_t MarlinSettings::calc_num_meshes() {
-      return (meshes_end - meshes_start_index()) / MESH_STORE_SIZE;
+      const uint16_t n = (meshes_end - meshes_start_index()) / MESH_STORE_SIZE;
+      return TERN(MESH_BANK, n ? n - 1 : 0, n);   // MESH_BANK keeps one for the reference
     }
 
     int MarlinSettings::mesh_slot_offset(const int8_t slot) {
-      return meshes_end - (slot + 1) * MESH_STORE_SIZE;
+      return meshes_end - (slot + 1 + ENABLED(MESH_BANK)) * MESH_STORE_SIZE;
     }
 
     void MarlinSettings::store_mesh(const int8_t slot) {
@@ -2561,21 +2641,49 @@ void MarlinSettings::postprocess() {
           return;
         }
 
-        int pos = mesh_slot_offset(slot);
-        uint16_t crc = 0;
+        #if ENABLED(MESH_BANK)
+
+          persistentStore.access_start();
 
-        #if ENABLED(OPTIMIZED_MESH_STORAGE)
-          int16_t z_mesh_store[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+          mesh_store_t z_mesh_store, ref_values;
           ubl.set_store_from_mesh(ubl.z_values, z_mesh_store);
-          uint8_t * const src = (uint8_t*)&z_mesh_store;
+
+          // The first mesh saved becomes the reference
+          mesh_bank_slot_t bank;
+          uint16_t ref_crc;
+          bool has_ref = mesh_bank_read(MESH_BANK_REF, ref_values, ref_crc);
+          if (!has_ref && mesh_bank_pack(bank, z_mesh_store) && !mesh_bank_write(MESH_BANK_REF, bank))
+            has_ref = mesh_bank_read(MESH_BANK_REF, ref_values, ref_crc);
+
+          // Pack as differences from the reference, or as-is if that doesn't fit
+          if (!(has_ref && mesh_bank_pack(bank, z_mesh_store, &ref_values, ref_crc)) && !mesh_bank_pack(bank, z_mesh_store)) {
+            persistentStore.access_finish();
+            SERIAL_ECHOLNPAIR("?Mesh doesn't fit in ", MESH_BANK_SLOT_SIZE, " bytes.");
+            return;
+          }
+
+          const bool status = mesh_bank_write(slot, bank);
+          persistentStore.access_finish();
+
         #else
-          uint8_t * const src = (uint8_t*)&ubl.z_values;
-        #endif
 
-        // Write crc to MAT along with other data, or just tack on to the beginning or end
-        persistentStore.access_start();
-        const bool status = persistentStore.write_data(pos, src, MESH_STORE_SIZE, &crc);
-        persistentStore.access_finish();
+          int pos = mesh_slot_offset(slot);
+          uint16_t crc = 0;
+
+          #if ENABLED(OPTIMIZED_MESH_STORAGE)
+            int16_t z_mesh_store[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+            ubl.set_store_from_mesh(ubl.z_values, z_mesh_store);
+            uint8_t * const src = (uint8_t*)&z_mesh_store;
+          #else
+            uint8_t * const src = (uint8_t*)&ubl.z_values;
+          #endif
+
+          // Write crc to MAT along with other data, or just tack on to the beginning or end
+          persistentStore.access_start();
+          const bool status = persistentStore.write_data(pos, src, MESH_STORE_SIZE, &crc);
+          persistentStore.access_finish();
+
+        #endif
 
         if (status) SERIAL_ECHOLNPGM("?Unable to save mesh data.");
         else        DEBUG_ECHOLNPAIR("Mesh saved in slot ", slot);
@@ -2587,7 +2695,7 @@ void MarlinSettings::postprocess() {
       #endif
     }
 
-    void MarlinSettings::load_mesh(const int8_t slot, void * const into/*=nullptr*/) {
+    bool MarlinSettings::load_mesh(const int8_t slot, void * const into/*=nullptr*/) {
 
       #if ENABLED(AUTO_BED_LEVELING_UBL)
 
@@ -2595,30 +2703,50 @@ void MarlinSettings::postprocess() {
 
         if (!WITHIN(slot, 0, a - 1)) {
           ubl_invalid_slot(a);
-          return;
+          return false;
         }
 
-        int pos = mesh_slot_offset(slot);
-        uint16_t crc = 0;
-        #if ENABLED(OPTIMIZED_MESH_STORAGE)
-          int16_t z_mesh_store[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
-          uint8_t * const dest = (uint8_t*)&z_mesh_store;
+        #if ENABLED(MESH_BANK)
+
+          const uint32_t start_us = micros();
+
+          mesh_store_t z_mesh_store;
+          uint16_t crc;
+          persistentStore.access_start();
+          const bool status = !mesh_bank_read(slot, z_mesh_store, crc);
+          persistentStore.access_finish();
+
+          // Leave the mesh unchanged if the slot is invalid
+          if (!status)
+            ubl.set_mesh_from_store(z_mesh_store, into ? *(bed_mesh_t*)into : ubl.z_values);
+
+          mesh_load_us = micros() - start_us;
+
         #else
-          uint8_t * const dest = into ? (uint8_t*)into : (uint8_t*)&ubl.z_values;
-        #endif
 
-        persistentStore.access_start();
-        const uint16_t status = persistentStore.read_data(pos, dest, MESH_STORE_SIZE, &crc);
-        persistentStore.access_finish();
+          int pos = mesh_slot_offset(slot);
+          uint16_t crc = 0;
+          #if ENABLED(OPTIMIZED_MESH_STORAGE)
+            int16_t z_mesh_store[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+            uint8_t * const dest = (uint8_t*)&z_mesh_store;
+          #else
+            uint8_t * const dest = into ? (uint8_t*)into : (uint8_t*)&ubl.z_values;
+          #endif
+
+          persistentStore.access_start();
+          const uint16_t status = persistentStore.read_data(pos, dest, MESH_STORE_SIZE, &crc);
+          persistentStore.access_finish();
+
+          #if ENABLED(OPTIMIZED_MESH_STORAGE)
+            if (into) {
+              float z_values[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+              ubl.set_mesh_from_store(z_mesh_store, z_values);
+              memcpy(into, z_values, sizeof(z_values));
+            }
+            else
+              ubl.set_mesh_from_store(z_mesh_store, ubl.z_values);
+          #endif
 
-        #if ENABLED(OPTIMIZED_MESH_STORAGE)
-          if (into) {
-            float z_values[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
-            ubl.set_mesh_from_store(z_mesh_store, z_values);
-            memcpy(into, z_values, sizeof(z_values));
-          }
-          else
-            ubl.set_mesh_from_store(z_mesh_store, ubl.z_values);
         #endif
 
         if (status) SERIAL_ECHOLNPGM("?Unable to load mesh data.");
@@ -2626,9 +2754,12 @@ void MarlinSettings::postprocess() {
 
         EEPROM_FINISH();
 
+        return !status;
+
       #else
 
         // Other mesh types
+        return false;
 
       #endif
     }
@@ -71,7 +71,10 @@ class MarlinSettings {
         static uint16_t calc_num_meshes();
         static int mesh_slot_offset(const int8_t slot);
         static void store_mesh(const int8_t slot);
-        static void load_mesh(const int8_t slot, void * const into=nullptr);
+        static bool load_mesh(const int8_t slot, void * const into=nullptr);
+        #if ENABLED(MESH_BANK)
+          static uint32_t mesh_load_us;   // Time taken by the last load_mesh
+        #endif
 
         //static void delete_mesh();    // necessary if we have a MAT
         //static void defrag_meshes();  // "
@@ -636,6 +636,10 @@ bool DiskIODriver_SPI_SD::writeData(const uint8_t token, const uint8_t *src) {
 bool DiskIODriver_SPI_SD::writeStart(uint32_t blockNumber, const uint32_t eraseCount) {
   if (ENABLED(SDCARD_READONLY)) return false;
 
+  #if IS_TEENSY_35_36 || IS_TEENSY_40_41
+    return false; // Only single block writes, see writeBlock()
+  #endif
+
   bool success = false;
   if (!cardAcmd(ACMD23, eraseCount)) {                    // Send pre-erase count
     if (type() != SD_CARD_TYPE_SDHC) blockNumber <<= 9;   // Use address if not SDHC card
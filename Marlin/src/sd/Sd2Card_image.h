@@ -0,0 +1,71 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Card image driver for the LINUX simulator
+ *
+ * Maps a FAT image file into memory in place of an SD card. The image is
+ * SD_IMAGE_FILE in the working directory, or the file named by the
+ * SD_IMAGE_FILE environment variable. Writes go straight to the file.
+ *
+ * Set SD_IMAGE_LATENCY to "read_us,write_us,stall_every,stall_us" to delay
+ * each block read and write, plus a longer stall on every Nth block write,
+ * so the effect of slow cards can be reproduced exactly.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#include "SdInfo.h"
+#include "disk_io_driver.h"
+
+class DiskIODriver_Image : public DiskIODriver {
+  public:
+    bool init(const uint8_t sckRateID=0, const pin_t chipSelectPin=0) override;
+
+    bool readCSD(csd_t *csd)                              override { return false; }
+
+    bool readStart(const uint32_t block)                  override { pos = block; return isReady(); }
+    bool readData(uint8_t *dst)                           override { return readBlock(pos++, dst); }
+    bool readStop()                                       override { return true; }
+
+    bool writeStart(const uint32_t block, const uint32_t) override { pos = block; return isReady(); }
+    bool writeData(const uint8_t *src)                    override { return writeBlock(pos++, src); }
+    bool writeStop()                                      override { return true; }
+
+    bool readBlock(uint32_t block, uint8_t *dst)          override;
+    bool writeBlock(uint32_t block, const uint8_t *src)   override;
+
+    uint32_t cardSize()                                   override { return blocks; }
+
+    bool isReady()                                        override { return image != nullptr; }
+
+    void idle()                                           override {}
+
+  private:
+    uint8_t *image = nullptr;
+    uint32_t blocks = 0, pos = 0;
+    bool writable = false;
+
+    // Injected latency
+    uint32_t read_us = 0, write_us = 0, stall_every = 0, stall_us = 0, writes = 0;
+};
@@ -50,6 +50,7 @@ bool SdBaseFile::addCluster() {
   if (ENABLED(SDCARD_READONLY)) return false;
 
   if (!vol_->allocContiguous(1, &curCluster_)) return false;
+  flags_ &= ~F_CONTIGUOUS;
 
   // if first cluster of file link to directory entry
   if (firstCluster_ == 0) {
@@ -108,6 +109,19 @@ bool SdBaseFile::close() {
   return rtn;
 }
 
+/**
+ * Check whether the file is contiguous, so that reads and seeks
+ * can find blocks without following the cluster chain.
+ *
+ * \return true if the file is contiguous.
+ */
+bool SdBaseFile::checkContiguous() {
+  uint32_t bgnBlock, endBlock;
+  const bool contig = isFile() && contiguousRange(&bgnBlock, &endBlock);
+  if (contig) flags_ |= F_CONTIGUOUS; else flags_ &= ~F_CONTIGUOUS;
+  return contig;
+}
+
 /**
  * Check for contiguous file and return its raw block range.
  *
@@ -179,6 +193,32 @@ bool SdBaseFile::createContiguous(SdBaseFile *dirFile, const char *path, uint32_
   return sync();
 }
 
+/**
+ * Reserve a contiguous run of clusters for an empty file opened for write,
+ * so writing up to \a size bytes never has to search for free clusters.
+ * Call truncate(fileSize()) when done to free any clusters left unused.
+ *
+ * \param[in] size The number of bytes to reserve.
+ *
+ * \return true for success, false for failure.
+ * Reasons for failure include the file already has clusters, \a size is
+ * zero or no free run of clusters is large enough.
+ */
+bool SdBaseFile::preAllocate(const uint32_t size) {
+  if (ENABLED(SDCARD_READONLY)) return false;
+
+  if (!isFile() || !(flags_ & O_WRITE) || firstCluster_ || size == 0) return false;
+
+  // calculate number of clusters needed
+  const uint32_t count = ((size - 1) >> (vol_->clusterSizeShift_ + 9)) + 1;
+
+  if (!vol_->allocContiguous(count, &firstCluster_)) return false;
+
+  // insure sync() will update dir entry
+  flags_ |= F_FILE_DIR_DIRTY;
+  return true;
+}
+
 /**
  * Return a file's directory entry.
  *
@@ -1013,20 +1053,7 @@ int16_t SdBaseFile::read(void *buf, uint16_t nbyte) {
   toRead = nbyte;
   while (toRead > 0) {
     offset = curPosition_ & 0x1FF;  // offset in block
-    if (type_ == FAT_FILE_TYPE_ROOT_FIXED) {
-      block = vol_->rootDirStart() + (curPosition_ >> 9);
-    }
-    else {
-      uint8_t blockOfCluster = vol_->blockOfCluster(curPosition_);
-      if (offset == 0 && blockOfCluster == 0) {
-        // start of new cluster
-        if (curPosition_ == 0)
-          curCluster_ = firstCluster_;                      // use first cluster in file
-        else if (!vol_->fatGet(curCluster_, &curCluster_))  // get next cluster from FAT
-          return -1;
-      }
-      block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
-    }
+    if (!currentBlock(&block)) return -1;
     uint16_t n = toRead;
 
     // amount to be read from current block
@@ -1049,6 +1076,55 @@ int16_t SdBaseFile::read(void *buf, uint16_t nbyte) {
   return nbyte;
 }
 
+/**
+ * Read the rest of the current block without copying it.
+ *
+ * \param[out] ptr Set to the data at the current position, which is
+ * in the volume cache. It stays valid until the cache is used for
+ * another block.
+ *
+ * \return The number of bytes at \a ptr, up to the end of the block
+ * or the end of the file. Zero is returned at the end of the file
+ * and -1 on error. The position advances past the returned bytes.
+ */
+int16_t SdBaseFile::readCached(const uint8_t* &ptr) {
+  uint32_t block;
+
+  // error if not open or write only
+  if (!isOpen() || !(flags_ & O_READ)) return -1;
+  if (curPosition_ >= fileSize_) return 0;
+
+  const uint16_t offset = curPosition_ & 0x1FF;
+  if (!currentBlock(&block) || !vol_->cacheRawBlock(block, SdVolume::CACHE_FOR_READ)) return -1;
+
+  uint16_t n = 512 - offset;
+  NOMORE(n, fileSize_ - curPosition_);
+  ptr = vol_->cache()->data + offset;
+  curPosition_ += n;
+  return n;
+}
+
+// Get the raw device block for the current position,
+// moving to the next cluster when at the start of one.
+bool SdBaseFile::currentBlock(uint32_t *block) {
+  if (type_ == FAT_FILE_TYPE_ROOT_FIXED) {
+    *block = vol_->rootDirStart() + (curPosition_ >> 9);
+    return true;
+  }
+  const uint8_t blockOfCluster = vol_->blockOfCluster(curPosition_);
+  if ((curPosition_ & 0x1FF) == 0 && blockOfCluster == 0) {
+    // start of new cluster
+    if (curPosition_ == 0)
+      curCluster_ = firstCluster_;                      // use first cluster in file
+    else if (flags_ & F_CONTIGUOUS)
+      curCluster_++;                                    // next cluster follows this one
+    else if (!vol_->fatGet(curCluster_, &curCluster_))  // get next cluster from FAT
+      return false;
+  }
+  *block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
+  return true;
+}
+
 /**
  * Calculate a checksum for an 8.3 filename
  *
@@ -1488,6 +1564,12 @@ bool SdBaseFile::seekSet(const uint32_t pos) {
   nCur = (curPosition_ - 1) >> (vol_->clusterSizeShift_ + 9);
   nNew = (pos - 1) >> (vol_->clusterSizeShift_ + 9);
 
+  if (flags_ & F_CONTIGUOUS) {
+    curCluster_ = firstCluster_ + nNew; // no chain to follow
+    curPosition_ = pos;
+    return true;
+  }
+
   if (nNew < nCur || curPosition_ == 0)
     curCluster_ = firstCluster_;      // must follow chain from first cluster
   else
@@ -1675,8 +1757,8 @@ bool SdBaseFile::truncate(uint32_t length) {
   // error if length is greater than current size
   if (length > fileSize_) return false;
 
-  // fileSize and length are zero - nothing to do
-  if (fileSize_ == 0) return true;
+  // fileSize and length are zero and no clusters reserved - nothing to do
+  if (fileSize_ == 0 && firstCluster_ == 0) return true;
 
   // remember position for seek after truncation
   newPos = curPosition_ > length ? length : curPosition_;
@@ -1781,12 +1863,20 @@ int16_t SdBaseFile::write(const void *buf, uint16_t nbyte) {
     // block for data write
     uint32_t block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
     if (n == 512) {
-      // full block - don't need to use cache
-      if (vol_->cacheBlockNumber() == block) {
-        // invalidate cache if block is in cache
+      // full blocks - don't need to use cache
+      uint16_t count = nToWrite >> 9;
+      // stay within the current cluster
+      NOMORE(count, vol_->blocksPerCluster_ - blockOfCluster);
+      if (vol_->cacheBlockNumber() - block < count) {
+        // invalidate cache if one of the blocks is in cache
         vol_->cacheSetBlockNumber(0xFFFFFFFF, false);
       }
-      if (!vol_->writeBlock(block, src)) goto FAIL;
+      if (count > 1) {
+        // write several blocks in one sequence
+        if (!vol_->writeBlocks(block, src, count)) goto FAIL;
+        n = count << 9;
+      }
+      else if (!vol_->writeBlock(block, src)) goto FAIL;
     }
     else {
       if (blockOffset == 0 && curPosition_ >= fileSize_) {
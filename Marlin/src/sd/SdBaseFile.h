@@ -187,10 +187,12 @@ class SdBaseFile {
    */
   void setpos(filepos_t *pos);
 
+  bool checkContiguous();
   bool close();
   bool contiguousRange(uint32_t *bgnBlock, uint32_t *endBlock);
   bool createContiguous(SdBaseFile *dirFile,
                         const char *path, uint32_t size);
+  bool preAllocate(const uint32_t size);
   /**
    * \return The current cluster number for a file or directory.
    */
@@ -298,6 +300,7 @@ class SdBaseFile {
   bool printName();
   int16_t read();
   int16_t read(void *buf, uint16_t nbyte);
+  int16_t readCached(const uint8_t* &ptr);
   int8_t readDir(dir_t *dir, char *longFilename);
   static bool remove(SdBaseFile *dirFile, const char *path);
   bool remove();
@@ -352,6 +355,7 @@ class SdBaseFile {
 
   // bits defined in flags_
   static uint8_t const F_OFLAG = (O_ACCMODE | O_APPEND | O_SYNC),   // should be 0x0F
+                       F_CONTIGUOUS = 0x40,                         // clusters are known to be contiguous
                        F_FILE_DIR_DIRTY = 0x80;                     // sync of directory entry required
 
   // private data
@@ -375,6 +379,7 @@ class SdBaseFile {
   bool addCluster();
   bool addDirCluster();
   dir_t* cacheDirEntry(uint8_t action);
+  bool currentBlock(uint32_t *block);
   int8_t lsPrintNext(uint8_t flags, uint8_t indent);
   static bool make83Name(const char *str, uint8_t *name, const char **ptr);
   bool mkdir(SdBaseFile *parent, const uint8_t dname[11]);
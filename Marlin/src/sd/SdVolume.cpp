@@ -44,6 +44,10 @@
   DiskIODriver *SdVolume::sdCard_;       // pointer to SD card object
   bool     SdVolume::cacheDirty_;        // cacheFlush() will write block if true
   uint32_t SdVolume::cacheMirrorBlock_;  // mirror  block for second FAT
+  #if ENABLED(SD_FAT_CACHE)
+    cache_t  SdVolume::fatCache_;        // 512 byte cache for FAT lookups
+    uint32_t SdVolume::fatCacheBlock_;   // current FAT block number
+  #endif
 #endif
 
 // find a contiguous group of clusters
@@ -187,8 +191,21 @@ bool SdVolume::fatGet(uint32_t cluster, uint32_t *value) {
   else
     return false;
 
-  if (lba != cacheBlockNumber_ && !cacheRawBlock(lba, CACHE_FOR_READ))
-    return false;
+  #if ENABLED(SD_FAT_CACHE)
+    // Read FAT blocks into their own cache, leaving file data in the block cache.
+    // The block cache is checked first since it holds any FAT changes not yet written.
+    if (lba != cacheBlockNumber_) {
+      if (lba != fatCacheBlock_) {
+        if (!sdCard_->readBlock(lba, fatCache_.data)) return false;
+        fatCacheBlock_ = lba;
+      }
+      *value = (fatType_ == 16) ? fatCache_.fat16[cluster & 0xFF] : (fatCache_.fat32[cluster & 0x7F] & FAT32MASK);
+      return true;
+    }
+  #else
+    if (lba != cacheBlockNumber_ && !cacheRawBlock(lba, CACHE_FOR_READ))
+      return false;
+  #endif
 
   *value = (fatType_ == 16) ? cacheBuffer_.fat16[cluster & 0xFF] : (cacheBuffer_.fat32[cluster & 0x7F] & FAT32MASK);
   return true;
@@ -242,6 +259,7 @@ bool SdVolume::fatPut(uint32_t cluster, uint32_t value) {
     return false;
 
   if (!cacheRawBlock(lba, CACHE_FOR_WRITE)) return false;
+  TERN_(SD_FAT_CACHE, if (lba == fatCacheBlock_) fatCacheBlock_ = 0xFFFFFFFF);
 
   // store entry
   if (fatType_ == 16)
@@ -254,6 +272,18 @@ bool SdVolume::fatPut(uint32_t cluster, uint32_t value) {
   return true;
 }
 
+// write consecutive blocks, in a multiple block sequence if the card supports it
+bool SdVolume::writeBlocks(uint32_t block, const uint8_t *src, uint16_t count) {
+  if (sdCard_->writeStart(block, count)) {
+    for (; count; count--, src += 512)
+      if (!sdCard_->writeData(src)) return false;
+    return sdCard_->writeStop();
+  }
+  for (; count; count--, src += 512)
+    if (!writeBlock(block++, src)) return false;
+  return true;
+}
+
 // free a cluster chain
 bool SdVolume::freeChain(uint32_t cluster) {
   // clear free cluster location
@@ -336,6 +366,7 @@ bool SdVolume::init(DiskIODriver* dev, uint8_t part) {
   cacheDirty_ = 0;  // cacheFlush() will write block if true
   cacheMirrorBlock_ = 0;
   cacheBlockNumber_ = 0xFFFFFFFF;
+  TERN_(SD_FAT_CACHE, fatCacheBlock_ = 0xFFFFFFFF);
 
   // if part == 0 assume super floppy with FAT boot sector in block zero
   // if part > 0 assume mbr volume with partition table
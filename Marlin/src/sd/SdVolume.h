@@ -42,6 +42,8 @@
   #include "Sd2Card_sdio.h"
 #elif NEED_SD2CARD_SPI
   #include "Sd2Card.h"
+#elif NEED_SD2CARD_IMAGE
+  #include "Sd2Card_image.h"
 #endif
 
 #include "SdFatConfig.h"
@@ -98,6 +100,7 @@ class SdVolume {
 
   // inline functions that return volume info
   uint8_t blocksPerCluster() const { return blocksPerCluster_; } //> \return The volume's cluster size in blocks.
+  uint32_t cacheBlockNumber() const { return cacheBlockNumber_; } //> \return The logical block number held in the cache.
   uint32_t blocksPerFat() const { return blocksPerFat_; }        //> \return The number of blocks in one FAT.
   uint32_t clusterCount() const { return clusterCount_; }        //> \return The total number of clusters in the volume.
   uint8_t clusterSizeShift() const { return clusterSizeShift_; } //> \return The shift count required to multiply by blocksPerCluster.
@@ -144,12 +147,20 @@ class SdVolume {
     DiskIODriver *sdCard_;       // DiskIODriver object for cache
     bool cacheDirty_;            // cacheFlush() will write block if true
     uint32_t cacheMirrorBlock_;  // block number for mirror FAT
+    #if ENABLED(SD_FAT_CACHE)
+      cache_t fatCache_;         // 512 byte cache for FAT lookups
+      uint32_t fatCacheBlock_;   // Logical number of block in the FAT cache
+    #endif
   #else
     static cache_t cacheBuffer_;        // 512 byte cache for device blocks
     static uint32_t cacheBlockNumber_;  // Logical number of block in the cache
     static DiskIODriver *sdCard_;       // DiskIODriver object for cache
     static bool cacheDirty_;            // cacheFlush() will write block if true
     static uint32_t cacheMirrorBlock_;  // block number for mirror FAT
+    #if ENABLED(SD_FAT_CACHE)
+      static cache_t fatCache_;         // 512 byte cache for FAT lookups
+      static uint32_t fatCacheBlock_;   // Logical number of block in the FAT cache
+    #endif
   #endif
 
   uint32_t allocSearchStart_;   // start cluster for alloc search
@@ -170,7 +181,6 @@ class SdVolume {
   uint32_t blockNumber(uint32_t cluster, uint32_t position) const { return clusterStartBlock(cluster) + blockOfCluster(position); }
 
   cache_t* cache() { return &cacheBuffer_; }
-  uint32_t cacheBlockNumber() const { return cacheBlockNumber_; }
 
   #if USE_MULTIPLE_CARDS
     bool cacheFlush();
@@ -198,4 +208,5 @@ class SdVolume {
   }
   bool readBlock(uint32_t block, uint8_t *dst) { return sdCard_->readBlock(block, dst); }
   bool writeBlock(uint32_t block, const uint8_t *dst) { return sdCard_->writeBlock(block, dst); }
+  bool writeBlocks(uint32_t block, const uint8_t *src, uint16_t count);
 };
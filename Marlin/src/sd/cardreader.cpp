@@ -36,6 +36,7 @@
 #include "../gcode/queue.h"
 #include "../module/settings.h"
 #include "../module/stepper/indirection.h"
+#include "../module/temperature.h"
 
 #if ENABLED(EMERGENCY_PARSER)
   #include "../feature/e_parser.h"
@@ -116,6 +117,16 @@ uint8_t CardReader::workDirDepth;
 
 #endif // SDCARD_SORT_ALPHA
 
+#if SD_DIR_INDEX
+  bool CardReader::dir_indexed; // = false
+  uint16_t CardReader::dir_count, CardReader::dir_index[SD_DIR_INDEX], CardReader::dir_index_end;
+  #if ENABLED(SDCARD_SORT_ALPHA)
+    uint32_t CardReader::dir_key[SD_DIR_INDEX];
+    uint8_t CardReader::dir_is_dir[(SD_DIR_INDEX + 7) >> 3];
+    #define DIR_INDEX_IS_DIR(n) TEST(dir_is_dir[(n) >> 3], (n) & 0x07)
+  #endif
+#endif
+
 #if SHARED_VOLUME_IS(USB_FLASH_DRIVE) || ENABLED(USB_FLASH_DRIVE_SUPPORT)
   DiskIODriver_USBFlash CardReader::media_usbFlashDrive;
 #endif
@@ -123,6 +134,8 @@ uint8_t CardReader::workDirDepth;
   DiskIODriver_SDIO CardReader::media_sdio;
 #elif NEED_SD2CARD_SPI
   DiskIODriver_SPI_SD CardReader::media_sd_spi;
+#elif NEED_SD2CARD_IMAGE
+  DiskIODriver_Image CardReader::media_image;
 #endif
 
 DiskIODriver* CardReader::driver = nullptr;
@@ -137,12 +150,34 @@ SdFile CardReader::file;
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+const uint8_t *CardReader::blk_ptr, *CardReader::blk_end;
+
+#if SD_READ_AHEAD
+  uint8_t CardReader::ra_buffer[SD_READ_AHEAD][512];
+  uint16_t CardReader::ra_length[SD_READ_AHEAD];
+  uint8_t CardReader::ra_head, CardReader::ra_count;
+  uint16_t CardReader::ra_stalls;
+  uint32_t CardReader::ra_stall_us, CardReader::ra_stall_max;
+#else
+  filepos_t CardReader::blk_pos;
+  uint32_t CardReader::blk_number;
+#endif
+
+#if ENABLED(SD_LOG_BUFFER)
+  uint8_t CardReader::log_buffer[512];
+  uint16_t CardReader::log_count; // = 0
+  bool CardReader::log_pending; // = false
+  millis_t CardReader::log_flush_ms;
+#endif
+
 CardReader::CardReader() {
   changeMedia(&
     #if SHARED_VOLUME_IS(SD_ONBOARD)
       media_sd_spi
     #elif SHARED_VOLUME_IS(USB_FLASH_DRIVE) || ENABLED(USB_FLASH_DRIVE_SUPPORT)
       media_usbFlashDrive
+    #elif NEED_SD2CARD_IMAGE
+      media_image
     #else
       TERN(SDIO_SUPPORT, media_sdio, media_sd_spi)
     #endif
@@ -230,9 +265,9 @@ int CardReader::countItems(SdFile dir) {
 //
 // Get file/folder info for an item by index
 //
-void CardReader::selectByIndex(SdFile dir, const uint8_t index) {
+void CardReader::selectByIndex(SdFile dir, const uint16_t index) {
   dir_t p;
-  for (uint8_t cnt = 0; dir.readDir(&p, longFilename) > 0;) {
+  for (uint16_t cnt = 0; dir.readDir(&p, longFilename) > 0;) {
     if (is_dir_or_gcode(p)) {
       if (cnt == index) {
         createFilename(filename, p);
@@ -243,6 +278,54 @@ void CardReader::selectByIndex(SdFile dir, const uint8_t index) {
   }
 }
 
+#if SD_DIR_INDEX
+
+  #if ENABLED(SDCARD_SORT_ALPHA)
+    // The first four characters of a name, case-folded, as a number that sorts like the name
+    static uint32_t sort_key(const char *name) {
+      uint32_t key = 0;
+      LOOP_L_N(i, 4) {
+        key <<= 8;
+        if (*name) key |= uint8_t(tolower(uint8_t(*name++)));
+      }
+      return key;
+    }
+  #endif
+
+  //
+  // Read the working directory once, noting where each item starts
+  // so it can be read again without scanning the items before it.
+  //
+  void CardReader::index_work_dir() {
+    dir_t p;
+    uint16_t c = 0;
+    workDir.rewind();
+    for (;;) {
+      const uint16_t entry = workDir.curPosition() >> 5;
+      if (workDir.readDir(&p, longFilename) <= 0) break;
+      if (!is_dir_or_gcode(p)) continue;
+      if (c < SD_DIR_INDEX) {
+        dir_index[c] = entry;
+        dir_index_end = workDir.curPosition() >> 5;
+        #if ENABLED(SDCARD_SORT_ALPHA)
+          createFilename(filename, p);
+          dir_key[c] = sort_key(longest_filename());
+          const uint8_t bit = c & 0x07, ind = c >> 3;
+          if (bit == 0) dir_is_dir[ind] = 0x00;
+          if (flag.filenameIsDir) SBI(dir_is_dir[ind], bit);
+        #endif
+      }
+      c++;
+    }
+    dir_count = c;
+    dir_indexed = true;
+    #if ALL(SDCARD_SORT_ALPHA, SDSORT_USES_RAM, SDSORT_CACHE_NAMES)
+      nrFiles = c;
+    #endif
+  }
+
+#endif // SD_DIR_INDEX
+
 //
 // Get file/folder info for an item by name
 //
@@ -256,12 +339,28 @@ void CardReader::selectByName(SdFile dir, const char * const match) {
   }
 }
 
+#if ENABLED(M20_PAGED_LISTING)
+  //
+  // Page of the listing being printed. Files before the
+  // start are counted but not printed, and the listing
+  // stops at the first file after the count runs out.
+  //
+  static uint8_t ls_flags;
+  static uint16_t ls_skip, ls_count, ls_index;
+  static bool ls_more;
+#endif
+
 //
 // Recursive method to list all files within a folder
 //
 void CardReader::printListing(SdFile parent, const char * const prepend/*=nullptr*/) {
+  static uint8_t ls_entries;
   dir_t p;
   while (parent.readDir(&p, longFilename) > 0) {
+    // Keep the heaters (and watchdog) going through a long listing. Not idle(),
+    // which may run other SD tasks and change the shared longFilename.
+    if (!(++ls_entries & 0x0F)) thermalManager.manage_heater();
+
     if (DIR_IS_SUBDIR(&p)) {
 
       // Get the short name for the item, which we know is a folder
@@ -290,13 +389,34 @@ void CardReader::printListing(SdFile parent, const char * const prepend/*=nullpt
 
       printListing(child, path);
       // close() is done automatically by destructor of SdFile
+      if (TERN0(M20_PAGED_LISTING, ls_more)) return;
     }
     else if (is_dir_or_gcode(p)) {
+      #if ENABLED(M20_PAGED_LISTING)
+        if (ls_skip) { ls_skip--; ls_index++; continue; }
+        if (!ls_count) { ls_more = true; return; }
+        ls_count--;
+        ls_index++;
+      #endif
       createFilename(filename, p);
       if (prepend) SERIAL_ECHO(prepend);
       SERIAL_ECHO(filename);
       SERIAL_CHAR(' ');
-      SERIAL_ECHOLN(p.fileSize);
+      SERIAL_ECHO(p.fileSize);
+      #if ENABLED(M20_PAGED_LISTING)
+        if (ls_flags & LS_TIMESTAMP) {
+          SERIAL_ECHOPGM(" 0x");
+          print_hex_word(p.lastWriteDate);
+          print_hex_word(p.lastWriteTime);
+        }
+        #if ENABLED(LONG_FILENAME_HOST_SUPPORT)
+          if ((ls_flags & LS_LONG_FILENAME) && longFilename[0]) {
+            SERIAL_CHAR(' ');
+            SERIAL_ECHO(longFilename);
+          }
+        #endif
+      #endif
+      SERIAL_EOL();
     }
   }
 }
@@ -304,12 +424,34 @@ void CardReader::printListing(SdFile parent, const char * const prepend/*=nullpt
 //
 // List all files on the SD card
 //
-void CardReader::ls() {
-  if (flag.mounted) {
+#if ENABLED(M20_PAGED_LISTING)
+
+  //
+  // List the files from 'start', up to 'count' of them if non-zero.
+  // Return the index of the next file, or 0 if none are left.
+  //
+  uint16_t CardReader::ls(const uint8_t lsflags/*=0*/, const uint16_t start/*=0*/, const uint16_t count/*=0*/) {
+    if (!flag.mounted) return 0;
+    ls_flags = lsflags;
+    ls_skip = start;
+    ls_count = count ?: 0xFFFF;
+    ls_index = 0;
+    ls_more = false;
     root.rewind();
     printListing(root);
+    return ls_more ? ls_index : 0;
   }
-}
+
+#else
+
+  void CardReader::ls() {
+    if (flag.mounted) {
+      root.rewind();
+      printListing(root);
+    }
+  }
+
+#endif
 
 #if ENABLED(LONG_FILENAME_HOST_SUPPORT)
 
@@ -487,8 +629,15 @@ void CardReader::release() {
   else
     endFilePrint();
 
+  TERN_(SD_PRINT_INDEX, print_index.close());
+  #if ENABLED(POWER_LOSS_RECOVERY) && POWER_LOSS_RECOVERY_SLOTS
+    recovery.close();
+  #endif
   flag.mounted = false;
   flag.workDirIsRoot = true;
+  #if SD_DIR_INDEX
+    flush_dir_index();
+  #endif
   #if ALL(SDCARD_SORT_ALPHA, SDSORT_USES_RAM, SDSORT_CACHE_NAMES)
     nrFiles = 0;
   #endif
@@ -525,13 +674,22 @@ void CardReader::startFileprint() {
 void CardReader::endFilePrint(TERN_(SD_RESORT, const bool re_sort/*=false*/)) {
   TERN_(ADVANCED_PAUSE_FEATURE, did_pause_print = 0);
   flag.sdprinting = flag.abort_sd_printing = false;
+  #if ENABLED(SD_LOG_BUFFER)
+    if (flag.saving && isFileOpen()) (void)log_flush();
+  #endif
   if (isFileOpen()) file.close();
+  blk_reset();
   TERN_(SD_RESORT, if (re_sort) presort());
 }
 
 void CardReader::openLogFile(const char * const path) {
   flag.logging = DISABLED(SDCARD_READONLY);
   IF_DISABLED(SDCARD_READONLY, openFileWrite(path));
+  #if ENABLED(SD_LOG_BUFFER) && SD_LOG_PREALLOCATE > 0
+    // Reserve contiguous space so that appending doesn't touch the FAT for a while.
+    // Sync now so the directory entry owns the clusters in case power is lost.
+    if (flag.saving && preallocate(uint32_t(SD_LOG_PREALLOCATE) << 10)) (void)file.sync();
+  #endif
 }
 
 //
@@ -627,6 +785,12 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
   if (file.open(diveDir, fname, O_READ)) {
     filesize = file.fileSize();
     sdpos = 0;
+    file.checkContiguous();   // Skip the FAT when reading and seeking, if possible
+    blk_reset();
+    TERN_(SD_PRINT_INDEX, if (!subcall_type) print_index.open(*diveDir, file, fname));
+    #if SD_READ_AHEAD
+      if (!subcall_type) { ra_stalls = 0; ra_stall_us = ra_stall_max = 0; }
+    #endif
 
     { // Don't remove this block, as the PORT_REDIRECT is a RAII
       PORT_REDIRECT(SerialMask::All);
@@ -655,6 +819,7 @@ void CardReader::openFileWrite(const char * const path) {
   TERN_(HAS_MEDIA_SUBCALLS, file_subcall_ctr = 0);
 
   endFilePrint();
+  TERN_(SD_PRINT_INDEX, print_index.close());
 
   SdFile *diveDir;
   const char * const fname = diveToFile(false, diveDir, path);
@@ -665,6 +830,10 @@ void CardReader::openFileWrite(const char * const path) {
   #else
     if (file.open(diveDir, fname, O_CREAT | O_APPEND | O_WRITE | O_TRUNC)) {
       flag.saving = true;
+      TERN_(SD_PRINT_INDEX, print_index.remove(*diveDir, fname));
+      #if SD_DIR_INDEX
+        flush_dir_index();
+      #endif
       selectFileByName(fname);
       TERN_(EMERGENCY_PARSER, emergency_parser.disable());
       echo_write_to_file(fname);
@@ -719,6 +888,10 @@ void CardReader::removeFile(const char * const name) {
     if (file.remove(curDir, fname)) {
       SERIAL_ECHOLNPAIR("File deleted:", fname);
       sdpos = 0;
+      TERN_(SD_PRINT_INDEX, print_index.remove(*curDir, fname));
+      #if SD_DIR_INDEX
+        flush_dir_index();
+      #endif
       TERN_(SDCARD_SORT_ALPHA, presort());
     }
     else
@@ -731,11 +904,117 @@ void CardReader::report_status() {
     SERIAL_ECHOPAIR(STR_SD_PRINTING_BYTE, sdpos);
     SERIAL_CHAR('/');
     SERIAL_ECHOLN(filesize);
+    #if ENABLED(SD_PRINT_INDEX)
+      if (print_index.loaded())
+        SERIAL_ECHOLNPAIR("SD printing layer ", print_index.layer() + 1, "/", print_index.layers());
+    #endif
   }
   else
     SERIAL_ECHOLNPGM(STR_SD_NOT_PRINTING);
 }
 
+//
+// Release the current block, such as after a seek
+//
+void CardReader::blk_reset() {
+  blk_ptr = blk_end = nullptr;
+  #if SD_READ_AHEAD
+    ra_head = ra_count = 0;
+  #endif
+}
+
+#if SD_READ_AHEAD
+
+  //
+  // Read the next block of the file into a free slot of the ring.
+  // The first read after a seek stops at the block boundary, so that
+  // all later reads are whole blocks that bypass the volume cache.
+  //
+  bool CardReader::ra_fill() {
+    if (ra_count >= SD_READ_AHEAD || !file.isOpen()) return false;
+    const uint8_t slot = (ra_head + ra_count) % (SD_READ_AHEAD);
+    const int16_t n = file.read(ra_buffer[slot], 512 - (file.curPosition() & 0x1FF));
+    if (n <= 0) return false;
+    ra_length[slot] = n;
+    ra_count++;
+    return true;
+  }
+
+  //
+  // The head block is used up. Move on to the next one, or read
+  // it now if idle() didn't get a chance to, and count the stall.
+  //
+  bool CardReader::next_block() {
+    if (blk_ptr) {
+      ra_head = (ra_head + 1) % (SD_READ_AHEAD);
+      ra_count--;
+      blk_ptr = blk_end = nullptr;
+    }
+    if (!ra_count) {
+      const uint32_t start_us = micros();
+      if (!ra_fill()) return false;
+      const uint32_t us = micros() - start_us;
+      ra_stalls++;
+      ra_stall_us += us;
+      NOLESS(ra_stall_max, us);
+    }
+    blk_ptr = ra_buffer[ra_head];
+    blk_end = blk_ptr + ra_length[ra_head];
+    return true;
+  }
+
+  void CardReader::read_ahead() {
+    if (flag.sdprinting && !flag.abort_sd_printing && isFileOpen()) ra_fill();
+  }
+
+  void CardReader::report_read_ahead() {
+    SERIAL_ECHO_MSG("SD read-ahead stalls:", ra_stalls, " total(ms):", ra_stall_us / 1000UL, " max(us):", ra_stall_max);
+  }
+
+#else
+
+  //
+  // Point at the rest of the next block in the volume cache. If the
+  // cache was used for another block, read the current one again.
+  //
+  bool CardReader::next_block() {
+    uint16_t skip = 0;
+    if (blk_ptr < blk_end) {
+      skip = sdpos - blk_pos.position;
+      file.setpos(&blk_pos);
+    }
+    else
+      file.getpos(&blk_pos);
+
+    const int16_t n = file.readCached(blk_ptr);
+    if (n <= 0) {
+      blk_ptr = blk_end = nullptr;
+      if (skip) file.seekSet(sdpos);
+      return false;
+    }
+    blk_end = blk_ptr + n;
+    blk_ptr += skip;
+    blk_number = volume.cacheBlockNumber();
+    return true;
+  }
+
+#endif // SD_READ_AHEAD
+
+//
+// Read directly from the file, dropping any buffered data
+//
+int16_t CardReader::read(void *buf, uint16_t nbyte) {
+  if (!file.isOpen()) return -1;
+  #if SD_READ_AHEAD
+    if (ra_count) setIndex(sdpos);
+  #else
+    if (blk_ptr < blk_end) { file.setpos(&blk_pos); setIndex(sdpos); }
+  #endif
+  const int16_t n = file.read(buf, nbyte);
+  sdpos = file.curPosition();
+  return n;
+}
+
 void CardReader::write_command(char * const buf) {
   char *begin = buf,
        *npos = nullptr,
@@ -749,11 +1028,63 @@ void CardReader::write_command(char * const buf) {
   end[1] = '\r';
   end[2] = '\n';
   end[3] = '\0';
-  file.write(begin);
+  #if ENABLED(SD_LOG_BUFFER)
+    if (!log_write(begin, end + 3 - begin)) file.writeError = true;
+  #else
+    file.write(begin);
+  #endif
 
   if (file.writeError) SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE);
 }
 
+#if ENABLED(SD_LOG_BUFFER)
+
+  /**
+   * Add bytes to the log buffer. The buffer holds the rest of the file's current
+   * block, so once the file is block-aligned each full buffer goes to the card
+   * in a single block write that doesn't pass through the volume cache.
+   * Return false if a block written now failed. Bytes still in the buffer are
+   * checked when they're written out by log_flush.
+   */
+  bool CardReader::log_write(const char *src, uint16_t len) {
+    bool ok = true;
+    while (len) {
+      const uint16_t room = 512 - (file.curPosition() & 0x1FF) - log_count,
+                     n = _MIN(len, room);
+      memcpy(&log_buffer[log_count], src, n);
+      log_count += n;
+      src += n;
+      len -= n;
+      if (n == room && !log_write_out()) ok = false;  // Keep going with the rest of the line
+    }
+    if (!log_pending) {
+      log_pending = true;
+      log_flush_ms = millis() + SEC_TO_MS(SD_LOG_FLUSH_INTERVAL);
+    }
+    return ok;
+  }
+
+  // Write the buffered bytes at the end of the file. The directory entry isn't updated.
+  bool CardReader::log_write_out() {
+    const uint16_t n = log_count;
+    log_count = 0;
+    return !n || file.write(log_buffer, n) == int16_t(n);
+  }
+
+  // Write the buffered bytes, then the volume cache and the directory entry
+  bool CardReader::log_flush() {
+    log_pending = false;
+    const bool ok = log_write_out();
+    return file.sync() && ok;
+  }
+
+  void CardReader::log_task() {
+    if (log_pending && ELAPSED(millis(), log_flush_ms) && isFileOpen() && !log_flush())
+      SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE);
+  }
+
+#endif // SD_LOG_BUFFER
+
 #if DISABLED(NO_SD_AUTOSTART)
   /**
    * Run all the auto#.g files. Called:
@@ -798,10 +1129,17 @@ void CardReader::write_command(char * const buf) {
 #endif
 
 void CardReader::closefile(const bool store_location/*=false*/) {
+  #if ENABLED(SD_LOG_BUFFER)
+    if (flag.saving) {
+      if (!log_flush()) SERIAL_ERROR_MSG(STR_SD_ERR_WRITE_TO_FILE);
+      if (flag.logging) (void)trimFile(); // Free the unused reserved space
+    }
+  #endif
   file.sync();
   file.close();
   flag.saving = flag.logging = false;
   sdpos = 0;
+  blk_reset();
   TERN_(EMERGENCY_PARSER, emergency_parser.enable());
 
   if (store_location) {
@@ -822,8 +1160,22 @@ void CardReader::selectFileByIndex(const uint16_t nr) {
       return;
     }
   #endif
-  workDir.rewind();
-  selectByIndex(workDir, nr);
+  #if SD_DIR_INDEX
+    // Jump to the item, or to the end of the index and scan from there
+    if (!dir_indexed) index_work_dir();
+    if (nr < SD_DIR_INDEX) {
+      if (nr < dir_count) {
+        workDir.seekSet(uint32_t(dir_index[nr]) << 5);
+        selectByIndex(workDir, 0);
+      }
+      return;
+    }
+    workDir.seekSet(uint32_t(dir_index_end) << 5);
+    selectByIndex(workDir, nr - SD_DIR_INDEX);
+  #else
+    workDir.rewind();
+    selectByIndex(workDir, nr);
+  #endif
 }
 
 //
@@ -844,8 +1196,13 @@ void CardReader::selectFileByName(const char * const match) {
 }
 
 uint16_t CardReader::countFilesInWorkDir() {
-  workDir.rewind();
-  return countItems(workDir);
+  #if SD_DIR_INDEX
+    if (!dir_indexed) index_work_dir();
+    return dir_count;
+  #else
+    workDir.rewind();
+    return countItems(workDir);
+  #endif
 }
 
 /**
@@ -934,6 +1291,9 @@ const char* CardReader::diveToFile(const bool update_cwd, SdFile* &diveDir, cons
 
   if (update_cwd) {
     workDir = *diveDir;
+    #if SD_DIR_INDEX
+      flush_dir_index();
+    #endif
     DEBUG_ECHOLNPAIR("diveToFile: final workDir = ", hex_address((void*)diveDir));
     flag.workDirIsRoot = (workDirDepth == 0);
     TERN_(SDCARD_SORT_ALPHA, presort());
@@ -951,6 +1311,9 @@ void CardReader::cd(const char * relpath) {
     flag.workDirIsRoot = false;
     if (workDirDepth < MAX_DIR_DEPTH)
       workDirParents[workDirDepth++] = workDir;
+    #if SD_DIR_INDEX
+      flush_dir_index();
+    #endif
     TERN_(SDCARD_SORT_ALPHA, presort());
   }
   else
@@ -960,6 +1323,9 @@ void CardReader::cd(const char * relpath) {
 int8_t CardReader::cdup() {
   if (workDirDepth > 0) {                                               // At least 1 dir has been saved
     workDir = --workDirDepth ? workDirParents[workDirDepth - 1] : root; // Use parent, or root if none
+    #if SD_DIR_INDEX
+      flush_dir_index();
+    #endif
     TERN_(SDCARD_SORT_ALPHA, presort());
   }
   if (!workDirDepth) flag.workDirIsRoot = true;
@@ -969,6 +1335,9 @@ int8_t CardReader::cdup() {
 void CardReader::cdroot() {
   workDir = root;
   flag.workDirIsRoot = true;
+  #if SD_DIR_INDEX
+    flush_dir_index();
+  #endif
   TERN_(SDCARD_SORT_ALPHA, presort());
 }
 
@@ -1091,73 +1460,59 @@ void CardReader::cdroot() {
           #endif
         }
 
-        // Bubble Sort
-        for (uint16_t i = fileCnt; --i;) {
-          bool didSwap = false;
-          uint8_t o1 = sort_order[0];
-          #if DISABLED(SDSORT_USES_RAM)
-            selectFileByIndex(o1);              // Pre-fetch the first entry and save it
-            strcpy(name1, longest_filename());  // so the loop only needs one fetch
-            #if ENABLED(HAS_FOLDER_SORTING)
-              bool dir1 = flag.filenameIsDir;
-            #endif
+        // Compare two items by folder setting and name. True if o1 sorts after o2.
+        auto sort_after = [&](const uint8_t o1, const uint8_t o2) -> bool {
+          #if HAS_FOLDER_SORTING
+            const int fs = TERN(SDSORT_GCODE, sort_folders, FOLDER_SORTING);
           #endif
 
-          for (uint16_t j = 0; j < i; ++j) {
-            const uint16_t o2 = sort_order[j + 1];
+          #if SD_DIR_INDEX
+            // The index has folder flags and name prefixes, so most pairs need no names
+            if (o1 < SD_DIR_INDEX && o2 < SD_DIR_INDEX) {
+              #if HAS_FOLDER_SORTING
+                const bool d1 = DIR_INDEX_IS_DIR(o1);
+                if (fs && d1 != DIR_INDEX_IS_DIR(o2)) return fs > 0 ? d1 : !d1;
+              #endif
+              if (dir_key[o1] != dir_key[o2]) return dir_key[o1] > dir_key[o2];
+            }
+          #endif
 
-            // Compare names from the array or just the two buffered names
-            #if ENABLED(SDSORT_USES_RAM)
-              #define _SORT_CMP_NODIR() (strcasecmp(sortnames[o1], sortnames[o2]) > 0)
-            #else
-              #define _SORT_CMP_NODIR() (strcasecmp(name1, name2) > 0)
+          #if ENABLED(SDSORT_USES_RAM)
+            #if HAS_FOLDER_SORTING
+              if (fs && IS_DIR(o1) != IS_DIR(o2)) return IS_DIR(fs > 0 ? o1 : o2);
             #endif
-
+            return strcasecmp(sortnames[o1], sortnames[o2]) > 0;
+          #else
+            // Fetch both names, keeping the first in a buffer
+            selectFileByIndex(o1);
+            strcpy(name1, longest_filename());
             #if HAS_FOLDER_SORTING
-              #if ENABLED(SDSORT_USES_RAM)
-                // Folder sorting needs an index and bit to test for folder-ness.
-                #define _SORT_CMP_DIR(fs) (IS_DIR(o1) == IS_DIR(o2) ? _SORT_CMP_NODIR() : IS_DIR(fs > 0 ? o1 : o2))
-              #else
-                #define _SORT_CMP_DIR(fs) ((dir1 == flag.filenameIsDir) ? _SORT_CMP_NODIR() : (fs > 0 ? dir1 : !dir1))
-              #endif
+              const bool dir1 = flag.filenameIsDir;
             #endif
-
-            // The most economical method reads names as-needed
-            // throughout the loop. Slow if there are many.
-            #if DISABLED(SDSORT_USES_RAM)
-              selectFileByIndex(o2);
-              const bool dir2 = flag.filenameIsDir;
-              char * const name2 = longest_filename(); // use the string in-place
-            #endif // !SDSORT_USES_RAM
-
-            // Sort the current pair according to settings.
-            if (
-              #if HAS_FOLDER_SORTING
-                #if ENABLED(SDSORT_GCODE)
-                  sort_folders ? _SORT_CMP_DIR(sort_folders) : _SORT_CMP_NODIR()
-                #else
-                  _SORT_CMP_DIR(FOLDER_SORTING)
-                #endif
-              #else
-                _SORT_CMP_NODIR()
-              #endif
-            ) {
-              // Reorder the index, indicate that sorting happened
-              // Note that the next o1 will be the current o1. No new fetch needed.
-              sort_order[j] = o2;
-              sort_order[j + 1] = o1;
-              didSwap = true;
-            }
-            else {
-              // The next o1 is the current o2. No new fetch needed.
-              o1 = o2;
-              #if DISABLED(SDSORT_USES_RAM)
-                TERN_(HAS_FOLDER_SORTING, dir1 = dir2);
-                strcpy(name1, name2);
-              #endif
-            }
+            selectFileByIndex(o2);
+            #if HAS_FOLDER_SORTING
+              if (fs && dir1 != flag.filenameIsDir) return fs > 0 ? dir1 : !dir1;
+            #endif
+            return strcasecmp(name1, longest_filename()) > 0;
+          #endif
+        };
+
+        // Heap Sort
+        auto sift_down = [&](uint16_t root, const uint16_t end) {
+          for (uint16_t child; (child = 2 * root + 1) < end; root = child) {
+            if (child + 1 < end && sort_after(sort_order[child + 1], sort_order[child])) child++;
+            if (!sort_after(sort_order[child], sort_order[root])) break;
+            const uint8_t o = sort_order[root];
+            sort_order[root] = sort_order[child];
+            sort_order[child] = o;
           }
-          if (!didSwap) break;
+        };
+        for (uint16_t i = fileCnt / 2; i--;) sift_down(i, fileCnt);
+        for (uint16_t i = fileCnt; --i;) {
+          const uint8_t o = sort_order[0];
+          sort_order[0] = sort_order[i];
+          sort_order[i] = o;
+          sift_down(0, i);
         }
         // Using RAM but not keeping names around
         #if ENABLED(SDSORT_USES_RAM) && DISABLED(SDSORT_CACHE_NAMES)
@@ -1222,6 +1577,7 @@ uint16_t CardReader::get_num_Files() {
 void CardReader::fileHasFinished() {
   planner.synchronize();
   file.close();
+  blk_reset();
 
   #if HAS_MEDIA_SUBCALLS
     if (file_subcall_ctr > 0) { // Resume calling file after closing procedure
@@ -1233,6 +1589,11 @@ void CardReader::fileHasFinished() {
     }
   #endif
 
+  #if SD_READ_AHEAD
+    report_read_ahead();
+  #endif
+
+  TERN_(SD_PRINT_INDEX, print_index.close());
   endFilePrint(TERN_(SD_RESORT, true));
   marlin_state = MF_SD_COMPLETE;
 }
@@ -1252,7 +1613,12 @@ void CardReader::fileHasFinished() {
   void CardReader::openJobRecoveryFile(const bool read) {
     if (!isMounted()) return;
     if (recovery.file.isOpen()) return;
-    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_CREAT | O_WRITE | O_TRUNC | O_SYNC))
+    #if POWER_LOSS_RECOVERY_SLOTS
+      constexpr uint8_t write_flags = O_CREAT | O_RDWR; // The ring is rewritten in place, not truncated or synced
+    #else
+      constexpr uint8_t write_flags = O_CREAT | O_WRITE | O_TRUNC | O_SYNC;
+    #endif
+    if (!recovery.file.open(&root, recovery.filename, read ? O_READ : write_flags))
       openFailed(recovery.filename);
     else if (!read)
       echo_write_to_file(recovery.filename);
@@ -44,6 +44,10 @@ extern const char M23_STR[], M24_STR[];
 #include "SdFile.h"
 #include "disk_io_driver.h"
 
+#if ENABLED(SD_PRINT_INDEX)
+  #include "../feature/print_index.h"
+#endif
+
 #if ENABLED(USB_FLASH_DRIVE_SUPPORT)
   #include "usb_flashdrive/Sd2Card_FlashDrive.h"
 #endif
@@ -52,6 +56,8 @@ extern const char M23_STR[], M24_STR[];
   #include "Sd2Card_sdio.h"
 #elif NEED_SD2CARD_SPI
   #include "Sd2Card.h"
+#elif NEED_SD2CARD_IMAGE
+  #include "Sd2Card_image.h"
 #endif
 
 #if ENABLED(MULTI_VOLUME)
@@ -110,7 +116,12 @@ public:
   static void mount();
   static void release();
   static inline bool isMounted() { return flag.mounted; }
-  static void ls();
+  #if ENABLED(M20_PAGED_LISTING)
+    enum LsFlags : uint8_t { LS_LONG_FILENAME = _BV(0), LS_TIMESTAMP = _BV(1) };
+    static uint16_t ls(const uint8_t lsflags=0, const uint16_t start=0, const uint16_t count=0);
+  #else
+    static void ls();
+  #endif
 
   // Handle media insert/remove
   static void manage_media();
@@ -118,6 +129,9 @@ public:
   // SD Card Logging
   static void openLogFile(const char * const path);
   static void write_command(char * const buf);
+  #if ENABLED(SD_LOG_BUFFER)
+    static void log_task();         // Flush the buffered lines when the interval is up
+  #endif
 
   #if DISABLED(NO_SD_AUTOSTART)     // Auto-Start auto#.g file handling
     static uint8_t autofile_index;  // Next auto#.g index to run, plus one. Ignored by autofile_check when zero.
@@ -160,10 +174,21 @@ public:
   static inline void pauseSDPrint() { flag.sdprinting = false; }
   static inline bool isPaused() { return isFileOpen() && !flag.sdprinting; }
   static inline bool isPrinting() { return flag.sdprinting; }
+  // With a layer index, progress is by filament used
   #if HAS_PRINT_PROGRESS_PERMYRIAD
-    static inline uint16_t permyriadDone() { return (isFileOpen() && filesize) ? sdpos / ((filesize + 9999) / 10000) : 0; }
+    static inline uint16_t permyriadDone() {
+      #if ENABLED(SD_PRINT_INDEX)
+        if (isFileOpen() && print_index.loaded()) return print_index.permyriad(sdpos);
+      #endif
+      return (isFileOpen() && filesize) ? sdpos / ((filesize + 9999) / 10000) : 0;
+    }
   #endif
-  static inline uint8_t percentDone() { return (isFileOpen() && filesize) ? sdpos / ((filesize + 99) / 100) : 0; }
+  static inline uint8_t percentDone() {
+    #if ENABLED(SD_PRINT_INDEX)
+      if (isFileOpen() && print_index.loaded()) return print_index.permyriad(sdpos) / 100;
+    #endif
+    return (isFileOpen() && filesize) ? sdpos / ((filesize + 99) / 100) : 0;
+  }
 
   // Helper for open and remove
   static const char* diveToFile(const bool update_cwd, SdFile* &curDir, const char * const path, const bool echo=false);
@@ -190,12 +215,35 @@ public:
   static inline uint32_t getIndex() { return sdpos; }
   static inline uint32_t getFileSize() { return filesize; }
   static inline bool eof() { return sdpos >= filesize; }
-  static inline void setIndex(const uint32_t index) { file.seekSet((sdpos = index)); }
   static inline char* getWorkDirName() { workDir.getDosName(filename); return filename; }
-  static inline int16_t get() { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
-  static inline int16_t read(void *buf, uint16_t nbyte) { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+  static inline void setIndex(const uint32_t index) { blk_reset(); file.seekSet((sdpos = index)); }
+  static inline int16_t get() {
+    if (!blk_ready() && !next_block()) return -1;
+    sdpos++;
+    return *blk_ptr++;
+  }
+
+  // Get the bytes at sdpos that are already in memory, up to the end of
+  // their block, without consuming them. Returns 0 at EOF or on error.
+  static inline uint16_t peek(const char* &ptr) {
+    if (!blk_ready() && !next_block()) return 0;
+    ptr = (const char*)blk_ptr;
+    return blk_end - blk_ptr;
+  }
+  // Consume bytes returned by peek()
+  static inline void advance(const uint16_t n) { blk_ptr += n; sdpos += n; }
+
+  static int16_t read(void *buf, uint16_t nbyte);
+  #if SD_READ_AHEAD
+    static void read_ahead();       // Fill one block in idle time
+    static void report_read_ahead();
+  #endif
   static inline int16_t write(void *buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
 
+  // Reserve space for a file being written, then free what went unused
+  static inline bool preallocate(const uint32_t size) { return file.isOpen() && file.preAllocate(size); }
+  static inline bool trimFile() { return file.isOpen() && file.truncate(file.fileSize()); }
+
   // TODO: rename to diskIODriver()
   static DiskIODriver* diskIODriver() { return driver; }
 
@@ -214,6 +262,8 @@ public:
     static DiskIODriver_SDIO media_sdio;
   #elif NEED_SD2CARD_SPI
     static DiskIODriver_SPI_SD media_sd_spi;
+  #elif NEED_SD2CARD_IMAGE
+    static DiskIODriver_Image media_image;
   #endif
 
 private:
@@ -284,7 +334,44 @@ private:
   static SdFile file;
 
   static uint32_t filesize, // Total size of the current file, in bytes
-                  sdpos;    // Index most recently read (one behind file.getPos)
+                  sdpos;    // Index of the next byte to be read
+
+  //
+  // The block being read by get() and peek()
+  //
+  static const uint8_t *blk_ptr, *blk_end;
+
+  #if SD_READ_AHEAD
+    // Ring of whole blocks, filled in idle time. The head is the current block.
+    static uint8_t ra_buffer[SD_READ_AHEAD][512];
+    static uint16_t ra_length[SD_READ_AHEAD];
+    static uint8_t ra_head,         // Slot being consumed by get()
+                   ra_count;        // Filled slots, including the head
+    static uint16_t ra_stalls;      // Blocks read synchronously by get()
+    static uint32_t ra_stall_us,    // Total time spent in those reads
+                    ra_stall_max;   // Longest single stall
+    static bool ra_fill();
+    static inline bool blk_ready() { return blk_ptr < blk_end; }
+  #else
+    // The current block is read in place from the volume cache
+    static filepos_t blk_pos;       // File position at the start of the block
+    static uint32_t blk_number;     // Volume block that holds it
+    static inline bool blk_ready() { return blk_ptr < blk_end && volume.cacheBlockNumber() == blk_number; }
+  #endif
+
+  static void blk_reset();
+  static bool next_block();
+
+  #if ENABLED(SD_LOG_BUFFER)
+    // Lines written to the open file, up to the end of its current block
+    static uint8_t log_buffer[512];
+    static uint16_t log_count;      // Bytes waiting in the buffer
+    static bool log_pending;        // Written since the last flush
+    static millis_t log_flush_ms;   // When to flush
+    static bool log_write(const char *src, uint16_t len);
+    static bool log_write_out();
+    static bool log_flush();
+  #endif
 
   //
   // Procedure calls to other files
@@ -300,10 +387,26 @@ private:
   //
   static bool is_dir_or_gcode(const dir_t &p);
   static int countItems(SdFile dir);
-  static void selectByIndex(SdFile dir, const uint8_t index);
+  static void selectByIndex(SdFile dir, const uint16_t index);
   static void selectByName(SdFile dir, const char * const match);
   static void printListing(SdFile parent, const char * const prepend=nullptr);
 
+  //
+  // Index of the items in the working directory, built on first use
+  //
+  #if SD_DIR_INDEX
+    static bool dir_indexed;
+    static uint16_t dir_count,                    // Items in the folder, which may be more than are indexed
+                    dir_index[SD_DIR_INDEX],      // Directory entry where each item starts
+                    dir_index_end;                // Directory entry after the last indexed item
+    #if ENABLED(SDCARD_SORT_ALPHA)
+      static uint32_t dir_key[SD_DIR_INDEX];      // First characters of each name, for sorting
+      static uint8_t dir_is_dir[(SD_DIR_INDEX + 7) >> 3];
+    #endif
+    static void index_work_dir();
+    static inline void flush_dir_index() { dir_indexed = false; }
+  #endif
+
   #if ENABLED(SDCARD_SORT_ALPHA)
     static void flush_presort();
   #endif
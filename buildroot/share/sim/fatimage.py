@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+#
+# fatimage.py
+#
+# Build and read small FAT16 card images for the simulator's card image driver.
+# Images are unpartitioned (a "superfloppy") with 8.3 names in the root directory.
+#
+import struct
+
+SECTOR = 512
+SECTORS_PER_CLUSTER = 4
+RESERVED = 1
+FATS = 2
+ROOT_ENTRIES = 512
+TOTAL_SECTORS = 65536   # 32MB
+
+def _name83(name):
+    base, _, ext = name.upper().partition('.')
+    return (base.ljust(8)[:8] + ext.ljust(3)[:3]).encode()
+
+def make_image(path, files, fragment=False):
+    """
+    Write an image holding 'files', a list of (name, bytes).
+    With 'fragment' the clusters of all files are interleaved with gaps
+    between them, so every file is fragmented.
+    """
+    clusters = TOTAL_SECTORS // SECTORS_PER_CLUSTER
+    fat_sectors = (clusters + 2) * 2 // SECTOR + 1
+    root = RESERVED + FATS * fat_sectors
+    data_start = root + ROOT_ENTRIES * 32 // SECTOR
+    cluster_bytes = SECTORS_PER_CLUSTER * SECTOR
+
+    image = bytearray(TOTAL_SECTORS * SECTOR)
+    struct.pack_into('<3s8sHBHBHHBHHHII', image, 0, b'\xEB\x3C\x90', b'MARLINFS',
+                     SECTOR, SECTORS_PER_CLUSTER, RESERVED, FATS, ROOT_ENTRIES, 0, 0xF8,
+                     fat_sectors, 32, 64, 0, TOTAL_SECTORS)
+    image[510:512] = b'\x55\xAA'
+
+    fat = [0] * (clusters + 2)
+    fat[0:2] = [0xFFF8, 0xFFFF]
+
+    counts = [max(1, (len(data) + cluster_bytes - 1) // cluster_bytes) for _, data in files]
+    chains = [[] for _ in files]
+    cluster = 2
+    if fragment:
+        remaining = list(counts)
+        while any(remaining):
+            for i in range(len(files)):
+                if remaining[i]:
+                    chains[i].append(cluster)
+                    cluster += 1
+                    remaining[i] -= 1
+            cluster += 1
+    else:
+        for i, count in enumerate(counts):
+            chains[i] = list(range(cluster, cluster + count))
+            cluster += count
+
+    for i, (name, data) in enumerate(files):
+        chain = chains[i]
+        for j, c in enumerate(chain):
+            fat[c] = chain[j + 1] if j + 1 < len(chain) else 0xFFFF
+            chunk = data[j * cluster_bytes:(j + 1) * cluster_bytes]
+            offset = (data_start + (c - 2) * SECTORS_PER_CLUSTER) * SECTOR
+            image[offset:offset + len(chunk)] = chunk
+        entry = struct.pack('<11sBBBHHHHHHHI', _name83(name), 0x20, 0, 0, 0, 0, 0, 0, 0, 0,
+                            chain[0] if data else 0, len(data))
+        image[root * SECTOR + i * 32:root * SECTOR + (i + 1) * 32] = entry
+
+    table = struct.pack('<%dH' % len(fat), *fat)
+    for k in range(FATS):
+        offset = (RESERVED + k * fat_sectors) * SECTOR
+        image[offset:offset + len(table)] = table
+
+    with open(path, 'wb') as f:
+        f.write(image)
+
+class Image:
+    """Read files back out of an image."""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.image = f.read()
+        (_, spc, reserved, fats, self.root_entries, _, _, fat_sectors) = struct.unpack_from('<HBHBHHBH', self.image, 11)
+        total = struct.unpack_from('<H', self.image, 19)[0] or struct.unpack_from('<I', self.image, 32)[0]
+        self.spc = spc
+        self.root = reserved + fats * fat_sectors
+        self.data_start = self.root + self.root_entries * 32 // SECTOR
+        self.clusters = (total - self.data_start) // spc
+        self.fat = struct.unpack_from('<%dH' % (fat_sectors * SECTOR // 2), self.image, reserved * SECTOR)
+
+    def _entry(self, name):
+        name = _name83(name)
+        for i in range(self.root_entries):
+            offset = self.root * SECTOR + i * 32
+            if self.image[offset:offset + 11] == name:
+                return struct.unpack_from('<H', self.image, offset + 26)[0], struct.unpack_from('<I', self.image, offset + 28)[0]
+        return None
+
+    def chain(self, cluster):
+        chain = []
+        while 2 <= cluster < 0xFFF8:
+            chain.append(cluster)
+            cluster = self.fat[cluster]
+        return chain
+
+    def read(self, name):
+        """Return the contents of a file, or None if it isn't there."""
+        entry = self._entry(name)
+        if entry is None:
+            return None
+        first, size = entry
+        data = b''.join(self.image[(self.data_start + (c - 2) * self.spc) * SECTOR:(self.data_start + (c - 1) * self.spc) * SECTOR]
+                        for c in self.chain(first))
+        return data[:size]
+
+    def clusters_of(self, name):
+        entry = self._entry(name)
+        return len(self.chain(entry[0])) if entry else 0
+
+    def free_clusters(self):
+        return sum(1 for c in range(2, self.clusters + 2) if self.fat[c] == 0)
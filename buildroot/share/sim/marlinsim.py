@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+#
+# marlinsim.py
+#
+# Drive the LINUX simulator over a pseudo-terminal for the simulator tests.
+# The simulator's stdout is only unbuffered on a terminal, so a pipe won't do.
+#
+import os, pty, re, select, signal, time, tty
+
+def line_checksum(line):
+    cs = 0
+    for c in line.encode():
+        cs ^= c
+    return cs
+
+def numbered(n, command):
+    """Return command as a numbered line with a checksum, as hosts send it."""
+    line = 'N%d %s' % (n, command)
+    return '%s*%d\n' % (line, line_checksum(line))
+
+class SimError(Exception):
+    pass
+
+class Simulator:
+    """A running simulator, started in 'workdir' so the EEPROM and card image stay there."""
+
+    def __init__(self, program, workdir, env=None, log=None):
+        self.buffer = b''
+        self.log = log
+        environment = dict(os.environ)
+        environment.update(env or {})
+        self.pid, self.fd = pty.fork()
+        if self.pid == 0:
+            tty.setraw(0)
+            os.chdir(workdir)
+            os.execve(program, [program], environment)
+        self.expect(r'^start$', 20)
+        self.idle(1.0)  # Let setup() finish
+
+    def close(self):
+        if self.pid:
+            os.kill(self.pid, signal.SIGKILL)
+            os.waitpid(self.pid, 0)
+            os.close(self.fd)
+            self.pid = 0
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
+    def write(self, data):
+        if isinstance(data, str):
+            data = data.encode()
+        while data:
+            n = os.write(self.fd, data)
+            data = data[n:]
+
+    def fill(self, timeout):
+        """Read what's available, waiting up to 'timeout'. Return False on timeout."""
+        r, _, _ = select.select([self.fd], [], [], max(0, timeout))
+        if not r:
+            return False
+        try:
+            data = os.read(self.fd, 65536)
+        except OSError:
+            raise SimError('Simulator exited')
+        if self.log:
+            self.log.write(data)
+        self.buffer += data
+        return True
+
+    def readline(self, timeout=10):
+        """Return the next line without its end, or None on timeout."""
+        end = time.time() + timeout
+        while b'\n' not in self.buffer:
+            if not self.fill(end - time.time()):
+                return None
+        line, self.buffer = self.buffer.split(b'\n', 1)
+        return line.rstrip(b'\r').decode(errors='replace')
+
+    def read(self, count, timeout=10):
+        """Return exactly 'count' raw bytes."""
+        end = time.time() + timeout
+        while len(self.buffer) < count:
+            if not self.fill(end - time.time()):
+                raise SimError('Timed out reading %d bytes' % count)
+        data, self.buffer = self.buffer[:count], self.buffer[count:]
+        return data
+
+    def idle(self, seconds):
+        """Wait, dropping any output."""
+        end = time.time() + seconds
+        while self.fill(end - time.time()):
+            pass
+        self.buffer = b''
+
+    def expect(self, pattern, timeout=10):
+        """Read lines up to one matching 'pattern'. Return the match."""
+        end = time.time() + timeout
+        while True:
+            line = self.readline(end - time.time())
+            if line is None:
+                raise SimError('Timed out waiting for /%s/' % pattern)
+            m = re.search(pattern, line)
+            if m:
+                return m
+
+    def command(self, command, timeout=30):
+        """Send a command and return the lines it printed before its 'ok'."""
+        self.write(command + '\n')
+        lines = []
+        end = time.time() + timeout
+        while True:
+            line = self.readline(end - time.time())
+            if line is None:
+                raise SimError('Timed out waiting for %s' % command)
+            if line.startswith('ok'):
+                return lines
+            if line.startswith('Error:') or line.startswith('!!'):
+                raise SimError('%s: %s' % (command, line))
+            lines.append(line)
@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+#
+# run_tests.py program test [test ...]
+#
+# Run simulator tests from the tests folder against a LINUX simulator build.
+# Each test runs in a fresh working folder, which is kept if the test fails.
+#
+import importlib.util, os, shutil, sys, tempfile, traceback
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(0, HERE)
+
+import fatimage
+from marlinsim import Simulator, SimError
+
+class TestFailed(Exception):
+    pass
+
+class Context:
+    def __init__(self, program, workdir):
+        self.program = program
+        self.workdir = workdir
+        self.log = open(os.path.join(workdir, 'serial.log'), 'wb')
+
+    def path(self, name):
+        return os.path.join(self.workdir, name)
+
+    def start(self, env=None):
+        """Start the simulator with the card image and EEPROM in the working folder."""
+        return Simulator(self.program, self.workdir, env, self.log)
+
+    def make_image(self, files, fragment=False):
+        fatimage.make_image(self.path('sdcard.img'), files, fragment)
+
+    def image(self):
+        return fatimage.Image(self.path('sdcard.img'))
+
+    def check(self, condition, message):
+        if not condition:
+            raise TestFailed(message)
+
+    def note(self, message):
+        print('  ' + message)
+        sys.stdout.flush()
+
+def run(program, name):
+    spec = importlib.util.spec_from_file_location(name, os.path.join(HERE, 'tests', name + '.py'))
+    module = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(module)
+
+    workdir = tempfile.mkdtemp(prefix='marlinsim-%s-' % name)
+    ctx = Context(program, workdir)
+    print('\033[0;32m[Simulator]\033[0m %s...' % name)
+    sys.stdout.flush()
+    try:
+        module.run(ctx)
+    except (TestFailed, SimError) as e:
+        print('\033[0;31mFailed:\033[0m %s (see %s)' % (e, workdir))
+        return False
+    except Exception:
+        traceback.print_exc()
+        print('\033[0;31mFailed\033[0m (see %s)' % workdir)
+        return False
+    ctx.log.close()
+    shutil.rmtree(workdir)
+    print('\033[0;32mPassed\033[0m')
+    return True
+
+if __name__ == '__main__':
+    if len(sys.argv) < 3:
+        sys.exit('usage: %s program test [test ...]' % sys.argv[0])
+    program = os.path.abspath(sys.argv[1])
+    results = [run(program, name) for name in sys.argv[2:]]
+    sys.exit(0 if all(results) else 1)
@@ -0,0 +1,57 @@
+#
+# flow_credits.py
+#
+# Stream a job over the pty with M577 flow credits, keeping as many bytes in
+# flight as the window allows instead of waiting for each "ok". Check that
+# every line ran exactly once, with no resends or errors.
+#
+import re, time
+from marlinsim import numbered
+
+LINES = 3000
+STEP = 0.01     # E per line
+
+def run(ctx):
+    with ctx.start() as sim:
+        caps = sim.command('M115')
+        ctx.check('Cap:FLOW_CREDITS:1' in caps, 'FLOW_CREDITS is not in M115')
+        sim.command('M302 P1')
+        sim.command('M83')
+        sim.command('G92 E0')
+        sim.command('M110 N0')
+
+        sim.write('M577 S1\n')
+        m = sim.expect(r'^FLOW_CREDITS:1 W(\d+) C(\d+) B(\d+)')
+        window, credit = int(m.group(1)), int(m.group(2))
+        sim.expect(r'^ok')
+        ctx.check(window > 0, 'No credit window')
+
+        lines = [numbered(n, 'G1 E%.2f F6000' % STEP).encode() for n in range(1, LINES + 1)]
+        lines.append(numbered(LINES + 1, 'M400').encode())
+
+        sent, most, oks, index = credit, 0, 0, 0
+        started = time.time()
+        while oks < len(lines):
+            while index < len(lines) and (sent + len(lines[index]) - credit) <= window:
+                sim.write(lines[index])
+                sent += len(lines[index])
+                index += 1
+            most = max(most, sent - credit)
+            line = sim.readline(20)
+            ctx.check(line is not None, 'Timed out after %d lines, %d oks' % (index, oks))
+            ctx.check(not re.match(r'^(Error|Resend|echo:Unknown)', line), line)
+            if line.startswith('ok'):
+                oks += 1
+                m = re.search(r' C(\d+)', line)
+                ctx.check(m, 'No credit in "%s"' % line)
+                credit = int(m.group(1)) + (sent & ~0xFFFF)   # Unwrap the 16-bit count
+                if credit > sent: credit -= 0x10000
+                ctx.check(re.search(r' B\d+', line), 'No free slots in "%s"' % line)
+        ctx.note('%d lines in %.1fs, up to %d bytes in flight' % (len(lines), time.time() - started, most))
+        ctx.check(credit == sent, 'Credit %d, sent %d' % (credit, sent))
+        ctx.check(most > len(lines[0]) * 4, 'Never streamed ahead')
+
+        sim.command('M577 S0')
+        position = ' '.join(sim.command('M114'))
+        m = re.search(r'E:(-?[\d.]+)', position)
+        ctx.check(m and abs(float(m.group(1)) - LINES * STEP) < 0.001, 'Ended at ' + position)
@@ -0,0 +1,21 @@
+#
+# parse_float.py
+#
+# Compare GCodeParser::parse_float with strtof bit for bit with D104, over edge
+# cases and a long run of slicer-style numbers, and report the time of each.
+#
+import re
+
+COUNT = 200000
+
+def run(ctx):
+    with ctx.start() as sim:
+        result = sim.command('D104 C%d' % COUNT, 120)
+        report = ' '.join(result)
+        m = re.search(r'D104 numbers:(\d+) mismatches:(\d+) parse_float:(\d+)us strtof:(\d+)us', report)
+        ctx.check(m, 'No D104 report in "%s"' % report)
+        numbers, mismatches, ours, libc = (int(g) for g in m.groups())
+        first = [l for l in result if l.startswith('D104 mismatch:')]
+        ctx.check(numbers >= COUNT, 'Only %d numbers compared' % numbers)
+        ctx.check(not mismatches, '%d mismatches, first %s' % (mismatches, first[0] if first else '?'))
+        ctx.note('%d numbers: parse_float %.1fms, strtof %.1fms' % (numbers, ours / 1000, libc / 1000))
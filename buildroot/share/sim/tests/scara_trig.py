@@ -0,0 +1,25 @@
+#
+# scara_trig.py
+#
+# Compare the SCARA_TRIG_TABLE lookups with the math library using D105, and
+# check the XY error of inverse kinematics with the tables, turned back into
+# XY with the math library.
+#
+import re
+
+LIMITS = { 'sin': 10.0, 'atan2': 5.0, 'acos': 10.0 }  # Radians x 1e-6
+XY_LIMIT = 5.0                                      # Microns
+
+def run(ctx):
+    with ctx.start() as sim:
+        report = ' '.join(sim.command('D105 C200000', 120))
+
+    m = re.search(r'D105 error\(1e-6\) sin:([\d.]+) atan2:([\d.]+) acos:([\d.]+) xy\(um\):([\d.]+) table:(\d+)us libm:(\d+)us', report)
+    ctx.check(m, 'No D105 report in "%s"' % report)
+    errors = dict(zip(('sin', 'atan2', 'acos'), (float(v) for v in m.group(1, 2, 3))))
+    xy, table, libm = float(m.group(4)), int(m.group(5)), int(m.group(6))
+    for name, limit in LIMITS.items():
+        ctx.check(errors[name] < limit, '%s error %.2fe-6 is over %.0fe-6' % (name, errors[name], limit))
+    ctx.check(xy < XY_LIMIT, 'XY error %.2fum is over %.0fum' % (xy, XY_LIMIT))
+    ctx.note('sin %.2fe-6, atan2 %.2fe-6, acos %.2fe-6, xy %.2fum, table %.1fms, libm %.1fms' % (
+        errors['sin'], errors['atan2'], errors['acos'], xy, table / 1000, libm / 1000))
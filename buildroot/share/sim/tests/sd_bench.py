@@ -0,0 +1,33 @@
+#
+# sd_bench.py
+#
+# Time reading the lines of a large job from a fragmented card image with D103,
+# scanning in place from the current block and with get() a byte at a time.
+# Both passes must find the same lines and the same characters.
+#
+import random, re
+
+def job(rnd):
+    lines = ['; sd_bench test job', 'G21', 'G90', 'M82']
+    e = 0.0
+    while sum(len(l) + 1 for l in lines) < 500000:
+        if rnd.random() < 0.01: lines.append(';LAYER:%d' % len(lines))
+        e += rnd.random()
+        line = 'G1 X%.3f Y%.3f E%.5f' % (rnd.uniform(0, 220), rnd.uniform(0, 220), e)
+        if rnd.random() < 0.05: line += ' ; comment'
+        lines.append(line)
+    return ('\n'.join(lines) + '\n').encode(), len(lines)
+
+def run(ctx):
+    data, count = job(random.Random(42))
+    ctx.make_image([('FILLER.BIN', bytes(len(data))), ('BENCH.GCO', data)], fragment=True)
+
+    with ctx.start() as sim:
+        sim.command('M21')
+        result = ' '.join(sim.command('D103 BENCH.GCO', 600))
+        m = re.search(r'D103 lines:(\d+) scan:(\d+)us get:(\d+)us (\w+)', result)
+        ctx.check(m, 'No D103 report in "%s"' % result)
+        lines, scan, get, match = int(m.group(1)), int(m.group(2)), int(m.group(3)), m.group(4)
+        ctx.check(lines == count, 'Read %d lines of %d' % (lines, count))
+        ctx.check(match == 'match', 'The scan and get() passes differ')
+        ctx.note('%d bytes: scan %.1fms, get() %.1fms' % (len(data), scan / 1000, get / 1000))
@@ -0,0 +1,56 @@
+#
+# sd_print.py
+#
+# Print a job from a fragmented card image and check that every line ran once,
+# in order, including comments, blank lines, lines that span blocks, and a last
+# line with no newline.
+#
+import re
+
+MARKERS = 60
+
+def job():
+    lines = ['; sd_print test job', '', 'M302 P1', 'M83', 'G92 X0 Y0 Z0 E0']
+    x = 0
+    for n in range(MARKERS):
+        for i in range(40):
+            x = 10 + (n + i) % 7
+            line = 'G1 X%d Y%d F6000' % (x, n % 5)
+            if i % 9 == 0: line += ' ; trailing comment'
+            if i % 13 == 0: line = '    ' + line
+            lines.append(line)
+            if i % 11 == 0: lines.append('; ' + 'long comment ' * 8)
+            if i % 17 == 0: lines.append('')
+        lines.append('M118 L%d' % n)
+    lines += ['M400', 'M118 X%d Y%d' % (x, (MARKERS - 1) % 5)]
+    return '\n'.join(lines).encode()  # No newline after the last line
+
+def run(ctx):
+    data = job()
+    filler = bytes(range(256)) * 300
+    ctx.make_image([('FILLER.BIN', filler), ('JOB.GCO', data)], fragment=True)
+
+    with ctx.start() as sim:
+        sim.command('M21')
+        lines = sim.command('M23 JOB.GCO')
+        ctx.check(any(('File opened: JOB.GCO Size: %d' % len(data)) in l for l in lines), 'JOB.GCO not opened')
+        sim.command('M24')
+
+        expected = 0
+        while True:
+            line = sim.readline(60)
+            ctx.check(line is not None, 'Timed out after L%d' % (expected - 1))
+            ctx.check('Unknown command' not in line and not line.startswith('Error'), line)
+            m = re.match(r'^L(\d+)$', line)
+            if m:
+                ctx.check(int(m.group(1)) == expected, 'Got %s, expected L%d' % (line, expected))
+                expected += 1
+            elif re.match(r'^X\d+ Y\d+$', line):
+                last = line
+                break
+        ctx.check(expected == MARKERS, 'Only %d of %d markers' % (expected, MARKERS))
+        sim.expect('Done printing file', 10)
+
+        x, y = re.match(r'X(\d+) Y(\d+)', last).groups()
+        position = ' '.join(sim.command('M114'))
+        ctx.check(re.search(r'X:%s\.00 Y:%s\.00' % (x, y), position), 'Ended at ' + position)
@@ -0,0 +1,113 @@
+#
+# sd_upload.py
+#
+# Upload files with the binary file transfer protocol (M28 B1) and check that
+# the card image holds them byte for byte, and that clusters reserved for an
+# announced size are trimmed to the data actually written.
+#
+import random, re, struct, time
+
+TOKEN = 0xB5AD
+CONTROL, FILE_TRANSFER = 0, 1
+SYNC, CLOSE = 1, 2
+QUERY, OPEN, FT_CLOSE, WRITE = 0, 1, 2, 3
+
+def fletcher(data, cs=0):
+    for value in data:
+        low = ((cs & 0xFF) + value) % 255
+        cs = ((((cs >> 8) + low) % 255) << 8) | low
+    return cs
+
+class BinaryStream:
+    def __init__(self, ctx, sim):
+        self.ctx, self.sim = ctx, sim
+        self.sync = 0
+        self.pending = []
+
+    def packet(self, protocol, type, payload=b''):
+        header = struct.pack('<BBH', self.sync & 0xFF, (protocol << 4) | type, len(payload))
+        header += struct.pack('<H', fletcher(header))
+        packet = struct.pack('<H', TOKEN) + header
+        if payload:
+            packet += payload + struct.pack('<H', fletcher(header + payload))
+        return packet
+
+    def start(self):
+        self.sim.command('M28 B1')
+        self.sim.write(self.packet(CONTROL, SYNC))
+        m = self.sim.expect(r'^ss(\d+),(\d+),')
+        self.sync, self.max_payload = int(m.group(1)), int(m.group(2))
+
+    def send(self, protocol, type, payload=b'', window=1):
+        """Send a packet, allowing 'window' packets to wait for their ok."""
+        self.sim.write(self.packet(protocol, type, payload))
+        self.pending.append(self.sync & 0xFF)
+        self.sync += 1
+        while len(self.pending) >= window:
+            self.acknowledge()
+
+    def acknowledge(self):
+        while True:
+            line = self.sim.readline(10)
+            self.ctx.check(line is not None, 'Timed out waiting for ok%d' % self.pending[0])
+            m = re.match(r'^(ok|rs|fe)(\d+)', line)
+            if m:
+                self.ctx.check(m.group(1) == 'ok' and int(m.group(2)) == self.pending[0], 'Got %s, expected ok%d' % (line, self.pending[0]))
+                self.pending.pop(0)
+                return
+            self.ctx.check(not line.startswith('PFT:') or line == 'PFT:success', line)
+
+    def flush(self):
+        while self.pending:
+            self.acknowledge()
+
+    def reply(self, protocol, type, payload=b''):
+        self.send(protocol, type, payload)
+        return self.sim.expect(r'^PFT:').string
+
+    def upload(self, name, data, announce=True):
+        open_packet = b'\0\0' + name.encode() + b'\0' + (struct.pack('<I', len(data)) if announce else b'')
+        self.ctx.check(self.reply(FILE_TRANSFER, OPEN, open_packet) == 'PFT:success', 'Open failed')
+        size = self.max_payload
+        for offset in range(0, len(data), size):
+            self.send(FILE_TRANSFER, WRITE, data[offset:offset + size], window=4)
+        self.flush()
+        self.send(FILE_TRANSFER, FT_CLOSE)
+        self.sim.expect(r'^PFT:success')
+
+    def stop(self):
+        self.send(CONTROL, CLOSE)
+        self.sim.idle(0.5)
+
+def run(ctx):
+    rnd = random.Random(46)
+    files = [
+        ('BIG.GCO', bytes(rnd.getrandbits(8) for _ in range(300000)), True),
+        ('SMALL.GCO', b'\n'.join(b'G1 X%d Y%d' % (i, i * 2) for i in range(2000)) + b'\n', False),
+        ('EMPTY.BIN', b'', True),
+    ]
+    ctx.make_image([('KEEP.TXT', b'keep this file\n')])
+    free_before = ctx.image().free_clusters()
+
+    with ctx.start() as sim:
+        sim.command('M21')
+        stream = BinaryStream(ctx, sim)
+        stream.start()
+        for name, data, announce in files:
+            started = time.time()
+            stream.upload(name, data, announce)
+            ctx.note('%s: %d bytes in %.1fs' % (name, len(data), time.time() - started))
+        stream.stop()
+        sim.command('M21')
+        listing = sim.command('M20')
+        ctx.check(any(l.startswith('BIG.GCO 300000') for l in listing), 'BIG.GCO not listed')
+
+    image = ctx.image()
+    ctx.check(image.read('KEEP.TXT') == b'keep this file\n', 'KEEP.TXT was changed')
+    used = 0
+    for name, data, _ in files:
+        ctx.check(image.read(name) == data, '%s differs from the upload' % name)
+        clusters = -(-len(data) // (image.spc * 512))
+        ctx.check(image.clusters_of(name) == clusters, '%s has %d clusters, expected %d' % (name, image.clusters_of(name), clusters))
+        used += clusters
+    ctx.check(image.free_clusters() == free_before - used, 'Reserved clusters were not freed')
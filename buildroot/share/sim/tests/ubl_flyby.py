@@ -0,0 +1,36 @@
+#
+# ubl_flyby.py
+#
+# Scan a UBL mesh with PROBE_FLYBY_SCAN (G29 P1 O) over a tilted bed. Points the
+# scan misses are probed normally, so the whole mesh must be filled in and
+# follow the tilt.
+#
+import math, re
+from ublmesh import read_mesh, mesh_positions
+
+BED = (2.0, 0.004, -0.003)  # z0, dz/dx, dz/dy
+TOLERANCE = 0.05            # Half of the PROBE_SCAN_Z_STEP in the test build
+
+def run(ctx):
+    with ctx.start({ 'SIM_BED': ','.join(str(v) for v in BED) }) as sim:
+        sim.command('G28', 120)
+        sim.command('G29 I999')
+        lines = sim.command('G29 P1 O', 600)
+        z = read_mesh(sim)
+        xs, ys = mesh_positions(sim, z)
+
+    found = [l for l in lines if l.startswith('Scan found')]
+    ctx.check(found, 'No scan report')
+    m = re.match(r'Scan found (\d+)/(\d+) points', found[0])
+    probed = sum(1 for l in lines if l.startswith('Probing mesh point'))
+    ctx.note('%s, %d probed after' % (found[0], probed))
+    ctx.check(int(m.group(1)) > 0, 'The scan found no points')
+
+    worst = 0
+    for i, x in enumerate(xs):
+        for j, y in enumerate(ys):
+            ctx.check(not math.isnan(z[i][j]), 'Point %d,%d was not measured' % (i, j))
+            expected = z[0][0] + BED[1] * (x - xs[0]) + BED[2] * (y - ys[0])
+            ctx.check(abs(z[i][j] - expected) < TOLERANCE, 'Z %.3f at %d,%d, expected %.3f' % (z[i][j], i, j, expected))
+            worst = max(worst, abs(z[i][j] - expected))
+    ctx.note('Largest error %.3fmm' % worst)
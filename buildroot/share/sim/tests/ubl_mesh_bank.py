@@ -0,0 +1,64 @@
+#
+# ubl_mesh_bank.py
+#
+# Save UBL meshes to MESH_BANK slots and load them back, also after a restart.
+# Saving slot 0 again must not change the reference mesh that other slots are
+# packed against, and loading a slot that was never saved must leave the mesh
+# alone.
+#
+import math
+from ublmesh import read_mesh
+
+TOLERANCE = 0.002
+
+def set_mesh(sim, size, f):
+    for i in range(size[0]):
+        for j in range(size[1]):
+            sim.command('M421 I%d J%d Z%.3f' % (i, j, f(i, j)))
+
+def check_mesh(ctx, sim, size, f, what):
+    z = read_mesh(sim)
+    for i in range(size[0]):
+        for j in range(size[1]):
+            ctx.check(abs(z[i][j] - f(i, j)) <= TOLERANCE, '%s: Z %.3f at %d,%d, expected %.3f' % (what, z[i][j], i, j, f(i, j)))
+
+def command(ctx, sim, cmd):
+    lines = sim.command(cmd)
+    ctx.check(not any(l.startswith('?') for l in lines), '%s: %s' % (cmd, ' '.join(lines)))
+    return lines
+
+def load(ctx, sim, slot):
+    lines = command(ctx, sim, 'G29 L%d' % slot)
+    ctx.check(any(l.startswith('Mesh loaded from slot %d' % slot) for l in lines), 'Slot %d not loaded' % slot)
+
+mesh_a = lambda i, j: 0.1 * i - 0.05 * j + 0.01 * i * j
+mesh_b = lambda i, j: mesh_a(i, j) + 0.013 * i + (0.2 if (i, j) == (1, 2) else 0)
+mesh_c = lambda i, j: -0.3 + 0.02 * j * j - 0.04 * i
+mesh_d = lambda i, j: 0.5
+
+def run(ctx):
+    with ctx.start() as sim:
+        z = read_mesh(sim)
+        size = (len(z), len(z[0]))
+        set_mesh(sim, size, mesh_a)
+        command(ctx, sim, 'G29 S0')     # The first save is also the reference
+        set_mesh(sim, size, mesh_b)
+        command(ctx, sim, 'G29 S1')
+        set_mesh(sim, size, mesh_c)
+        command(ctx, sim, 'G29 S0')     # Saving slot 0 again keeps the reference
+
+        load(ctx, sim, 1)
+        check_mesh(ctx, sim, size, mesh_b, 'Slot 1')
+        load(ctx, sim, 0)
+        check_mesh(ctx, sim, size, mesh_c, 'Slot 0')
+
+    with ctx.start() as sim:
+        load(ctx, sim, 1)
+        check_mesh(ctx, sim, size, mesh_b, 'Slot 1 after a restart')
+        load(ctx, sim, 0)
+        check_mesh(ctx, sim, size, mesh_c, 'Slot 0 after a restart')
+
+        set_mesh(sim, size, mesh_d)
+        lines = sim.command('G29 L2')
+        ctx.check(not any(l.startswith('Mesh loaded') for l in lines), 'Loaded slot 2, which was never saved')
+        check_mesh(ctx, sim, size, mesh_d, 'After loading an empty slot')
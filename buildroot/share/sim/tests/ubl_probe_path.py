@@ -0,0 +1,59 @@
+#
+# ubl_probe_path.py
+#
+# Probe a UBL mesh over a tilted bed with PROBE_PATH_OPTIMIZER. The path must
+# start at the point nearest the requested position, visit every point once,
+# be no slower than the seeds it was built from, and not change when leveling
+# debug output is on.
+#
+import math, re
+
+BED = (2.0, 0.003, -0.002)  # z0, dz/dx, dz/dy
+START = (30, 40)
+
+def probe_mesh(ctx, sim, debug):
+    """Probe the whole mesh from START. Return the probed points and the path report."""
+    sim.command('G29 I999')
+    sim.command('M111 S%d' % (32 if debug else 0))
+    sim.write('G29 P1 V3 X%d Y%d\n' % START)
+    points, times = [], {}
+    while True:
+        line = sim.readline(300)
+        ctx.check(line is not None, 'G29 P1 timed out')
+        ctx.check(not line.startswith('Error:') and not line.startswith('!!'), line)
+        if line.startswith('ok'): break
+        m = re.match(r'^Bed X: ([-\d.]+) Y: ([-\d.]+) Z: ([-\d.]+)', line)
+        if m: points.append(tuple(float(v) for v in m.groups()))
+        m = re.search(r'Probe path \((\d+) points\) serpentine:([\d.]+)s hilbert:([\d.]+)s nearest:([\d.]+)s', line)
+        if m: times.update(count=int(m.group(1)), serpentine=float(m.group(2)), hilbert=float(m.group(3)), nearest=float(m.group(4)))
+        m = re.search(r'Probe path 2-opt:([\d.]+)s', line)
+        if m: times['2-opt'] = float(m.group(1))
+    sim.command('M111 S0')
+    return points, times
+
+def run(ctx):
+    with ctx.start({ 'SIM_BED': ','.join(str(v) for v in BED) }) as sim:
+        sim.command('G28', 120)
+        quiet, _ = probe_mesh(ctx, sim, False)
+        loud, times = probe_mesh(ctx, sim, True)
+
+    ctx.check(quiet, 'No points were probed')
+    xy = [(x, y) for x, y, _ in quiet]
+    ctx.check(len(set(xy)) == len(xy), 'A point was probed twice')
+    ctx.check(times.get('count') == len(xy), 'Planned %s points, probed %d' % (times.get('count'), len(xy)))
+
+    distance = lambda p: math.hypot(p[0] - START[0], p[1] - START[1])
+    ctx.check(distance(xy[0]) == min(distance(p) for p in xy), 'The path starts at %s, not the nearest point' % (xy[0],))
+
+    ctx.check([(x, y) for x, y, _ in loud] == xy, 'Debug output changed the path')
+    ctx.check('2-opt' in times, 'No 2-opt report')
+    best = min(times['serpentine'], times['hilbert'], times['nearest'])
+    ctx.check(times['2-opt'] <= best + 0.01, '2-opt path %.2fs is slower than a seed (%.2fs)' % (times['2-opt'], best))
+    ctx.note('%d points: serpentine %.2fs, hilbert %.2fs, nearest %.2fs, 2-opt %.2fs' % (
+        len(xy), times['serpentine'], times['hilbert'], times['nearest'], times['2-opt']))
+
+    # The mesh follows the tilt of the bed
+    x0, y0, z0 = quiet[0]
+    for x, y, z in quiet:
+        expected = z0 + BED[1] * (x - x0) + BED[2] * (y - y0)
+        ctx.check(abs(z - expected) < 0.02, 'Z %.3f at (%g, %g), expected %.3f' % (z, x, y, expected))
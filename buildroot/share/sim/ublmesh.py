@@ -0,0 +1,23 @@
+#
+# ublmesh.py
+#
+# Read a UBL mesh and its bounds from the simulator for the simulator tests.
+#
+import re
+
+def read_mesh(sim):
+    """Return the mesh from 'G29 T1' as z[i][j], with NAN for unset points."""
+    lines = sim.command('G29 T1')
+    start = next(n for n, line in enumerate(lines) if line.startswith('Bed Topography Report for CSV'))
+    rows = [line.split('\t') for line in lines[start + 1:] if line.strip()]
+    rows = [[float(v) for v in row] for row in rows if all(re.match(r'^(-?[\d.]+|NAN)$', v) for v in row)]
+    rows.reverse()  # The report starts with the last row
+    return [[rows[j][i] for j in range(len(rows))] for i in range(len(rows[0]))]
+
+def mesh_positions(sim, z):
+    """Return the X positions of the mesh columns and the Y positions of its rows."""
+    lines = sim.command('G29 T0')
+    corners = [(int(x), int(y)) for x, y in re.findall(r'\(\s*(-?\d+),\s*(-?\d+)\)', ' '.join(lines))]
+    xs, ys = [x for x, _ in corners], [y for _, y in corners]
+    spread = lambda lo, hi, n: [lo + (hi - lo) * k / (n - 1) for k in range(n)]
+    return spread(min(xs), max(xs), len(z)), spread(min(ys), max(ys), len(z[0]))